@@ -0,0 +1,120 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Benchmark of a field update applied per owned leaf cell and per batch of consecutive owned leaf cells.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/RootCellEntry.h>
+#include <core/Tree.h>
+
+using Cell2D = Cell<2,2>;
+using Cell3D = Cell<2,2,2>;
+
+// Split the leaves below a cell down to max_level (only the first children below min_level to get several levels)
+template<typename CellType>
+void refineRecurs(const std::shared_ptr<CellType> &cell, const unsigned min_level, const unsigned max_level) {
+  if (cell->getLevel()>=max_level)
+    return;
+  if (cell->getLevel()>=min_level && cell->getSiblingNumber()!=0)
+    return;
+  if (cell->isLeaf())
+    cell->split(max_level);
+  for (const auto &child : cell->getChildCells())
+    refineRecurs(child, min_level, max_level);
+}
+
+// Run an update several times and return the number of leaves updated per second
+template<typename Update>
+double runUpdate(const Update &update, const unsigned number_leaves, const unsigned number_sweeps) {
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned sweep{0}; sweep<number_sweeps; ++sweep)
+    update();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(number_leaves)*number_sweeps/elapsed.count();
+}
+
+// Update u += dt*h(level)^2*f with one callback per leaf
+template<typename TreeType>
+double perCellUpdate(TreeType &tree, const std::vector<double> &scales, const unsigned number_sweeps) {
+  using CellType = typename TreeType::CellType;
+  auto u = tree.getField("u");
+  const auto f = static_cast<const TreeType&>(tree).getField("f");
+  return runUpdate([&]() {
+    tree.applyToOwnedLeaves([&](const std::shared_ptr<CellType> &cell, const unsigned index) {
+      u[index] += 1e-3*scales[cell->getLevel()]*f[index];
+    });
+  }, u.size(), number_sweeps);
+}
+
+// Update u += dt*h(level)^2*f with one callback per batch of N leaves
+template<unsigned N, typename TreeType>
+double batchedUpdate(TreeType &tree, const std::vector<double> &scales, const unsigned number_sweeps) {
+  using CellType = typename TreeType::CellType;
+  auto u = tree.getField("u");
+  const auto f = static_cast<const TreeType&>(tree).getField("f");
+  return runUpdate([&]() {
+    tree.template applyToOwnedLeafBatches<N>([&](const LeafBatch<CellType, N> &batch) {
+      // Full batch: contiguous loads and stores
+      double *u_batch = u.data() + batch.first_index;
+      const double *f_batch = f.data() + batch.first_index;
+      if (batch.full()) {
+        for (unsigned lane{0}; lane<N; ++lane)
+          u_batch[lane] += 1e-3*scales[batch.levels[lane]]*f_batch[lane];
+        return;
+      }
+      // Tail batch: full width computation on the gathered lanes then store of the valid lanes
+      std::array<double, N> values;
+      for (unsigned lane{0}; lane<N; ++lane)
+        values[lane] = u[batch.indices[lane]] + 1e-3*scales[batch.levels[lane]]*f[batch.indices[lane]];
+      for (unsigned lane{0}; lane<batch.size; ++lane)
+        u_batch[lane] = values[lane];
+    });
+  }, u.size(), number_sweeps);
+}
+
+// Compare the updates on a tree for a cell type
+template<typename CellType>
+void compareUpdates(const char *name, const unsigned max_level, const unsigned number_sweeps) {
+  using TreeType = Tree<CellType>;
+  auto root = std::make_shared<CellType>(nullptr);
+  std::vector<RootCellEntry<CellType>> entries { RootCellEntry<CellType>{root} };
+  TreeType tree(1, max_level);
+  tree.createRootCells(entries);
+  refineRecurs(root, max_level-1, max_level);
+  tree.addField("u");
+  tree.addField("f");
+  auto f = tree.getField("f");
+  for (unsigned i{0}; i<f.size(); ++i)
+    f[i] = i%11;
+  std::vector<double> scales(max_level+1);
+  for (unsigned level{0}; level<=max_level; ++level)
+    scales[level] = 1./(1u << (2*level));
+
+  const double leaves_per_second_cell = perCellUpdate(tree, scales, number_sweeps);
+  const double leaves_per_second_batch_4 = batchedUpdate<4>(tree, scales, number_sweeps);
+  const double leaves_per_second_batch_16 = batchedUpdate<16>(tree, scales, number_sweeps);
+
+  std::cout << name << " field update (max level " << max_level << ", " << f.size() << " leaves, " << number_sweeps << " sweeps)" << std::endl;
+  std::cout << "  per cell     : " << leaves_per_second_cell << " leaves/s" << std::endl;
+  std::cout << "  batches of 4 : " << leaves_per_second_batch_4 << " leaves/s (speedup " << leaves_per_second_batch_4/leaves_per_second_cell << ")" << std::endl;
+  std::cout << "  batches of 16: " << leaves_per_second_batch_16 << " leaves/s (speedup " << leaves_per_second_batch_16/leaves_per_second_cell << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+  const unsigned max_level = argc>1 ? std::atoi(argv[1]) : 6;
+  const unsigned number_sweeps = argc>2 ? std::atoi(argv[2]) : 20;
+
+  compareUpdates<Cell3D>("Octree", max_level, number_sweeps);
+  compareUpdates<Cell2D>("Quadtree", max_level+3, number_sweeps);
+  return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Benchmark of full-tree leaf sweeps with the tree iterators and the key driven leaf iterator.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/RootCellEntry.h>
+#include <core/Tree.h>
+#include <core/iterator/HilbertIterator.h>
+#include <core/iterator/MortonIterator.h>
+#include <core/iterator/SfcLeafIterator.h>
+
+using Cell3D = Cell<2,2,2>;
+using Cell2D = Cell<2,2>;
+
+// Split all the leaves below a cell down to max_level
+template<typename CellType>
+void refineRecurs(const std::shared_ptr<CellType> &cell, const unsigned max_level) {
+  if (cell->isLeaf()) {
+    if (cell->getLevel()>=max_level)
+      return;
+    cell->split(max_level);
+  }
+  for (const auto &child : cell->getChildCells())
+    refineRecurs(child, max_level);
+}
+
+// Sweep all the leaves and return the number of leaves visited per second
+template<typename IteratorType, typename TreeType>
+double runSweeps(const TreeType &tree, const unsigned number_sweeps) {
+  IteratorType iterator(tree.getRootCells(), tree.getMaxLevel());
+  unsigned long number_leaves{0};
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned sweep{0}; sweep<number_sweeps; ++sweep) {
+    iterator.toBegin();
+    do {
+      number_leaves += iterator.getCellPtr()->belongToThisProc();
+    } while (iterator.next());
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return number_leaves/elapsed.count();
+}
+
+// Compare the sweeps of a uniform tree for a curve
+template<typename CellType, typename TreeIteratorType>
+void compareSweeps(const char *name, const unsigned max_level, const unsigned number_sweeps) {
+  using TreeType = Tree<CellType, TreeIteratorType>;
+  auto root = std::make_shared<CellType>(nullptr);
+  std::vector<RootCellEntry<CellType>> entries { RootCellEntry<CellType>{root} };
+  TreeType tree(1, max_level);
+  tree.createRootCells(entries);
+  refineRecurs(root, max_level);
+
+  const double leaves_per_second_tree_iterator = runSweeps<TreeIteratorType>(tree, number_sweeps);
+  const double leaves_per_second_sfc_iterator = runSweeps<SfcLeafIterator<CellType, TreeIteratorType>>(tree, number_sweeps);
+
+  std::cout << name << " leaf sweeps (max level " << max_level << ", " << tree.countOwnedLeaves() << " leaves, " << number_sweeps << " sweeps)" << std::endl;
+  std::cout << "  tree iterator     : " << leaves_per_second_tree_iterator << " leaves/s" << std::endl;
+  std::cout << "  sfc leaf iterator : " << leaves_per_second_sfc_iterator << " leaves/s" << std::endl;
+  std::cout << "  speedup           : " << leaves_per_second_sfc_iterator/leaves_per_second_tree_iterator << std::endl;
+}
+
+int main(int argc, char **argv) {
+  const unsigned max_level = argc>1 ? std::atoi(argv[1]) : 6;
+  const unsigned number_sweeps = argc>2 ? std::atoi(argv[2]) : 10;
+
+  compareSweeps<Cell3D, MortonIterator<Cell3D>>("Morton 3D", max_level, number_sweeps);
+  compareSweeps<Cell2D, HilbertIterator<Cell2D>>("Hilbert 2D", max_level+3, number_sweeps);
+  return 0;
+}
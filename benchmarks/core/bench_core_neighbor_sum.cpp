@@ -0,0 +1,115 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Benchmark of a neighbor-sum kernel with type-erased callbacks (std::function), templated visitors and
+ *  the owned leaf and neighbor leaf ranges.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/RootCellEntry.h>
+#include <core/Tree.h>
+
+using Cell2D = Cell<2,2>;
+using Cell3D = Cell<2,2,2>;
+
+// Split all the leaves below a cell down to max_level
+template<typename CellType>
+void refineRecurs(const std::shared_ptr<CellType> &cell, const unsigned max_level) {
+  if (cell->isLeaf()) {
+    if (cell->getLevel()>=max_level)
+      return;
+    cell->split(max_level);
+  }
+  for (const auto &child : cell->getChildCells())
+    refineRecurs(child, max_level);
+}
+
+// Run a kernel several times and return the number of leaves visited per second
+template<typename Kernel>
+double runKernel(const Kernel &kernel, const unsigned number_leaves, const unsigned number_sweeps, double &checksum) {
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned sweep{0}; sweep<number_sweeps; ++sweep)
+    checksum += kernel();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(number_leaves)*number_sweeps/elapsed.count();
+}
+
+// Compare the neighbor-sum kernels on a uniform tree
+template<typename CellType>
+void compareKernels(const char *name, const unsigned max_level, const unsigned number_sweeps) {
+  using TreeType = Tree<CellType>;
+  using LeafFunctionType = std::function<void(const std::shared_ptr<CellType>&, const unsigned)>;
+  using NeighborFunctionType = std::function<void(const std::shared_ptr<CellType>&, const std::shared_ptr<CellType>&, const unsigned&)>;
+  auto root = std::make_shared<CellType>(nullptr);
+  std::vector<RootCellEntry<CellType>> entries { RootCellEntry<CellType>{root} };
+  TreeType tree(1, max_level);
+  tree.createRootCells(entries);
+  refineRecurs(root, max_level);
+  const unsigned number_leaves = tree.countOwnedLeaves();
+  tree.applyToOwnedLeaves([](const std::shared_ptr<CellType> &cell, const unsigned index) { cell->getCellData().setValue(index%7); });
+
+  // Type-erased callbacks
+  double checksum_function{0};
+  const double leaves_per_second_function = runKernel([&]() {
+    double sum{0};
+    const NeighborFunctionType neighbor_function = [&sum](const std::shared_ptr<CellType> &c, const std::shared_ptr<CellType> &n, const unsigned &dir) {
+      (void)c; (void)dir;
+      sum += n->getCellData().getValue();
+    };
+    const LeafFunctionType leaf_function = [&neighbor_function](const std::shared_ptr<CellType> &cell, const unsigned index) {
+      (void)index;
+      cell->applyToNeighborLeafCells(NeighborFunctionType(neighbor_function), false, true);
+    };
+    tree.applyToOwnedLeaves(leaf_function);
+    return sum;
+  }, number_leaves, number_sweeps, checksum_function);
+
+  // Templated visitors
+  double checksum_visitor{0};
+  const double leaves_per_second_visitor = runKernel([&]() {
+    double sum{0};
+    tree.applyToOwnedLeaves([&sum](const std::shared_ptr<CellType> &cell, const unsigned index) {
+      (void)index;
+      cell->applyToNeighborLeafCells([&sum](const std::shared_ptr<CellType> &c, const std::shared_ptr<CellType> &n, const unsigned &dir) {
+        (void)c; (void)dir;
+        sum += n->getCellData().getValue();
+      }, false, true);
+    });
+    return sum;
+  }, number_leaves, number_sweeps, checksum_visitor);
+
+  // Ranges
+  double checksum_range{0};
+  const double leaves_per_second_range = runKernel([&]() {
+    double sum{0};
+    for (const CellType &cell : tree.ownedLeaves())
+      for (const auto &neighbor : cell.neighborLeaves())
+        sum += neighbor.cell->getCellData().getValue();
+    return sum;
+  }, number_leaves, number_sweeps, checksum_range);
+
+  std::cout << name << " neighbor sum (max level " << max_level << ", " << number_leaves << " leaves, " << number_sweeps << " sweeps)" << std::endl;
+  std::cout << "  std::function : " << leaves_per_second_function << " leaves/s" << std::endl;
+  std::cout << "  visitor       : " << leaves_per_second_visitor << " leaves/s (speedup " << leaves_per_second_visitor/leaves_per_second_function << ")" << std::endl;
+  std::cout << "  range         : " << leaves_per_second_range << " leaves/s (speedup " << leaves_per_second_range/leaves_per_second_function << ")" << std::endl;
+  if (checksum_function != checksum_visitor || checksum_function != checksum_range)
+    std::cout << "  checksums differ: " << checksum_function << " " << checksum_visitor << " " << checksum_range << std::endl;
+}
+
+int main(int argc, char **argv) {
+  const unsigned max_level = argc>1 ? std::atoi(argv[1]) : 5;
+  const unsigned number_sweeps = argc>2 ? std::atoi(argv[2]) : 5;
+
+  compareKernels<Cell3D>("Octree", max_level, number_sweeps);
+  compareKernels<Cell2D>("Quadtree", max_level+3, number_sweeps);
+  return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Benchmark of uniform refinement/coarsening cycles with and without the oct allocator (median of
+ *  several alternated runs of each path).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/OctAllocator.h>
+
+using Cell3D = Cell<2,2,2>;
+
+// Split all the leaves below a cell down to max_level
+void refineRecurs(const std::shared_ptr<Cell3D> &cell, const unsigned max_level, unsigned long &number_octs) {
+  if (cell->isLeaf()) {
+    if (cell->getLevel()>=max_level)
+      return;
+    cell->split(max_level);
+    ++number_octs;
+  }
+  for (const auto &child : cell->getChildCells())
+    refineRecurs(child, max_level, number_octs);
+}
+
+// Coarsen all the cells below a cell down to min_level
+void coarsenRecurs(const std::shared_ptr<Cell3D> &cell, const unsigned min_level) {
+  if (cell->isLeaf())
+    return;
+  for (const auto &child : cell->getChildCells())
+    coarsenRecurs(child, min_level);
+  if (cell->getLevel()>=min_level)
+    cell->coarsen(min_level);
+}
+
+// Run refine/coarsen cycles and return the number of octs created per second
+double runCycles(const bool use_allocator, const unsigned max_level, const unsigned number_cycles) {
+  auto oct_allocator = std::make_shared<Cell3D::OctAllocatorType>();
+  auto root = std::make_shared<Cell3D>(nullptr);
+  if (use_allocator)
+    root->setOctAllocator(oct_allocator.get());
+  root->splitRoot(max_level, root);
+
+  unsigned long number_octs{0};
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned cycle{0}; cycle<number_cycles; ++cycle) {
+    refineRecurs(root, max_level, number_octs);
+    coarsenRecurs(root, 1);
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  root->clear();
+  return number_octs/elapsed.count();
+}
+
+// Median of a set of rates
+double median(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  return values[values.size()/2];
+}
+
+int main(int argc, char **argv) {
+  const unsigned max_level = argc>1 ? std::atoi(argv[1]) : 5;
+  const unsigned number_cycles = argc>2 ? std::atoi(argv[2]) : 10;
+  const unsigned number_runs = argc>3 ? std::max(std::atoi(argv[3]), 1) : 5;
+
+  // Both paths alternate so that they see the same machine load
+  std::vector<double> rates_default, rates_allocator;
+  for (unsigned run{0}; run<number_runs; ++run) {
+    rates_default.push_back(runCycles(false, max_level, number_cycles));
+    rates_allocator.push_back(runCycles(true, max_level, number_cycles));
+  }
+  const double octs_per_second_default = median(rates_default);
+  const double octs_per_second_allocator = median(rates_allocator);
+
+  std::cout << "Refine/coarsen cycles (3D, max level " << max_level << ", " << number_cycles << " cycles, median of " << number_runs << " runs)" << std::endl;
+  std::cout << "  heap blocks   : " << octs_per_second_default << " octs/s" << std::endl;
+  std::cout << "  oct allocator : " << octs_per_second_allocator << " octs/s" << std::endl;
+  std::cout << "  speedup       : " << octs_per_second_allocator/octs_per_second_default << std::endl;
+  return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Benchmark of the refinement of the leaves crossing a sphere surface level by level, with recursive
+ *  neighbor splitting (refine) and with a separate 2:1 balance pass and batched oct allocation (refineBulk).
+ */
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/RootCellEntry.h>
+#include <core/Tree.h>
+
+using Cell3D = Cell<2,2,2>;
+using Cell2D = Cell<2,2>;
+
+// Flag the leaves below a cell of box [corner, corner+size] crossing the sphere of center 0.5 and radius 0.3
+template<typename CellType>
+void flagSphereRecurs(const std::shared_ptr<CellType> &cell, const std::array<double, 3> &corner, const double size, const unsigned max_level) {
+  constexpr double center{0.5}, radius{0.3};
+  constexpr unsigned number_dimensions = CellType::number_dimensions;
+  if (cell->isLeaf()) {
+    if (cell->getLevel()>=max_level)
+      return;
+    double min_distance{0}, max_distance{0};
+    for (unsigned d{0}; d<number_dimensions; ++d) {
+      const double low = corner[d] - center, high = corner[d] + size - center;
+      const double nearest = low>0 ? low : (high<0 ? -high : 0.);
+      const double farthest = std::max(std::abs(low), std::abs(high));
+      min_distance += nearest*nearest;
+      max_distance += farthest*farthest;
+    }
+    if (min_distance<=radius*radius && radius*radius<=max_distance)
+      cell->setToRefine();
+    return;
+  }
+
+  // Child cells are numbered with x fastest
+  const double child_size = size/2;
+  for (unsigned i{0}; i<CellType::number_children; ++i) {
+    std::array<double, 3> child_corner = corner;
+    for (unsigned d{0}; d<number_dimensions; ++d)
+      child_corner[d] += ((i >> d) & 1)*child_size;
+    flagSphereRecurs(cell->getChildCell(i), child_corner, child_size, max_level);
+  }
+}
+
+// Refine the sphere surface down to max_level and return the refinement time (the flagging is not timed)
+template<typename CellType>
+double runSphere(const bool bulk, const unsigned max_level, unsigned &number_leaves, unsigned long &number_balance) {
+  auto root = std::make_shared<CellType>(nullptr);
+  std::vector<RootCellEntry<CellType>> entries { RootCellEntry<CellType>{root} };
+  Tree<CellType> tree(1, max_level);
+  tree.createRootCells(entries);
+
+  number_balance = 0;
+  std::chrono::duration<double> elapsed{0};
+  for (unsigned level{1}; level<max_level; ++level) {
+    flagSphereRecurs(root, {0., 0., 0.}, 1., level + 1);
+    const auto start = std::chrono::steady_clock::now();
+    if (bulk)
+      number_balance += tree.refineBulk().number_balance;
+    else
+      tree.refine();
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+
+  number_leaves = tree.countOwnedLeaves();
+  return elapsed.count();
+}
+
+template<typename CellType>
+void reportSphere(const char *name, const unsigned max_level) {
+  unsigned number_leaves{0}, number_bulk_leaves{0};
+  unsigned long number_balance{0};
+  const double time_default = runSphere<CellType>(false, max_level, number_leaves, number_balance);
+  const double time_bulk = runSphere<CellType>(true, max_level, number_bulk_leaves, number_balance);
+
+  std::cout << "Sphere surface refinement (" << name << ", max level " << max_level << ", " << number_leaves << " leaves)" << std::endl;
+  std::cout << "  recursive refine : " << time_default << " s" << std::endl;
+  std::cout << "  bulk refine      : " << time_bulk << " s (" << number_balance << " cells split for balance)" << std::endl;
+  std::cout << "  speedup          : " << time_default/time_bulk << std::endl;
+  if (number_leaves != number_bulk_leaves)
+    std::cout << "  mismatch         : " << number_bulk_leaves << " leaves after bulk refine" << std::endl;
+}
+
+int main(int argc, char **argv) {
+  const unsigned max_level_2d = argc>1 ? std::atoi(argv[1]) : 10;
+  const unsigned max_level_3d = argc>2 ? std::atoi(argv[2]) : 10;
+
+  reportSphere<Cell2D>("2D", max_level_2d);
+  reportSphere<Cell3D>("3D", max_level_3d);
+  return 0;
+}
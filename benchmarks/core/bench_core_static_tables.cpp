@@ -0,0 +1,105 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Benchmark of the lookups going through the static child, direction and curve tables (directional
+ *  child cells of a cell and Hilbert iterator steps).
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/RootCellEntry.h>
+#include <core/Tree.h>
+#include <core/iterator/HilbertIterator.h>
+
+using Cell3D = Cell<2,2,2>;
+using Cell2D = Cell<2,2>;
+
+// Split all the leaves below a cell down to max_level
+template<typename CellType>
+void refineRecurs(const std::shared_ptr<CellType> &cell, const unsigned max_level) {
+  if (cell->isLeaf()) {
+    if (cell->getLevel()>=max_level)
+      return;
+    cell->split(max_level);
+  }
+  for (const auto &child : cell->getChildCells())
+    refineRecurs(child, max_level);
+}
+
+// Create a uniform tree with a single root cell
+template<typename TreeType>
+std::unique_ptr<TreeType> makeUniformTree(const unsigned max_level) {
+  using CellType = typename TreeType::CellType;
+  auto root = std::make_shared<CellType>(nullptr);
+  std::vector<RootCellEntry<CellType>> entries { RootCellEntry<CellType>{root} };
+  auto tree = std::make_unique<TreeType>(1, max_level);
+  tree->createRootCells(entries);
+  refineRecurs(root, max_level);
+  return tree;
+}
+
+// Directional child cells of all the non-leaf cells in all the directions (lookups per second)
+template<typename CellType>
+double runDirChildCells(const unsigned max_level, const unsigned number_sweeps, unsigned long &checksum) {
+  using TreeType = Tree<CellType>;
+  const auto tree = makeUniformTree<TreeType>(max_level);
+  std::vector<CellType*> cells;
+  tree->applyToAllCells([&cells](const std::shared_ptr<CellType> &cell, const unsigned) {
+    if (!cell->isLeaf())
+      cells.push_back(cell.get());
+  });
+
+  unsigned long number_lookups{0};
+  checksum = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned sweep{0}; sweep<number_sweeps; ++sweep)
+    for (const CellType *cell : cells)
+      for (unsigned dir{0}; dir<CellType::number_volume_neighbors; ++dir) {
+        for (const CellType *child : cell->getDirChildCells(dir))
+          checksum += child->isLeaf();
+        ++number_lookups;
+      }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return number_lookups/elapsed.count();
+}
+
+// Hilbert iterator sweeps of all the leaves (steps per second)
+template<typename CellType>
+double runHilbertNext(const unsigned max_level, const unsigned number_sweeps) {
+  using TreeType = Tree<CellType>;
+  const auto tree = makeUniformTree<TreeType>(max_level);
+  HilbertIterator<CellType> iterator(tree->getRootCells(), tree->getMaxLevel());
+
+  unsigned long number_steps{0};
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned sweep{0}; sweep<number_sweeps; ++sweep) {
+    iterator.toBegin();
+    do {
+      number_steps += iterator.getCellPtr()->belongToThisProc();
+    } while (iterator.next());
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return number_steps/elapsed.count();
+}
+
+int main(int argc, char **argv) {
+  const unsigned max_level = argc>1 ? std::atoi(argv[1]) : 6;
+  const unsigned number_sweeps = argc>2 ? std::atoi(argv[2]) : 10;
+
+  std::cout << "Static tables (max level " << max_level << ", " << number_sweeps << " sweeps)" << std::endl;
+  unsigned long checksum{0};
+  const double lookups_3d = runDirChildCells<Cell3D>(max_level, number_sweeps, checksum);
+  std::cout << "  getDirChildCells 3D : " << lookups_3d << " lookups/s (checksum " << checksum << ")" << std::endl;
+  const double lookups_2d = runDirChildCells<Cell2D>(max_level+3, number_sweeps, checksum);
+  std::cout << "  getDirChildCells 2D : " << lookups_2d << " lookups/s (checksum " << checksum << ")" << std::endl;
+  std::cout << "  Hilbert next() 3D   : " << runHilbertNext<Cell3D>(max_level, number_sweeps) << " steps/s" << std::endl;
+  std::cout << "  Hilbert next() 2D   : " << runHilbertNext<Cell2D>(max_level+3, number_sweeps) << " steps/s" << std::endl;
+  return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Changes of the mesh made by an adaptation call of the tree (refine, coarsen, balanceLevels and
+ *  loadBalance) for updating the derived structures incrementally: keys of the parent cells of the created and removed
+ *  families along the SFC, and owned leaf ranges migrated to and from the other processes.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "OctAllocator.h"
+
+template<typename CellType, typename TreeIteratorType>
+class AdaptationLog : public OctAllocatorListener<CellType> {
+ public:
+  using CellKeyType = typename TreeIteratorType::CellKeyType;
+  using OctType = typename CellType::OctType;
+  // Owned leaf range migrated to (or from) another process, positions along the owned leaves of this process before
+  // the migration for the sent ranges and after it for the received ranges
+  struct MigratedRange {
+    unsigned rank;
+    unsigned first;
+    unsigned number_leaves;
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Iterator used for the key computations
+  TreeIteratorType iterator;
+  // Keys of the parent cells of the created and removed families (along the SFC once sorted)
+  std::vector<CellKeyType> created_families, removed_families;
+  // Owned leaf ranges migrated to and from the other processes (along the SFC)
+  std::vector<MigratedRange> sent_ranges, received_ranges;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor (the root cells must outlive the log)
+  AdaptationLog(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level);
+  // Destructor
+  ~AdaptationLog() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the keys of the parent cells of the created families (a family split during the same call is listed after
+  // its parent family)
+  const std::vector<CellKeyType>& getCreatedFamilies() const { return created_families; };
+  // Get the keys of the parent cells of the removed families (the families removed by cascading coarsening are all
+  // listed)
+  const std::vector<CellKeyType>& getRemovedFamilies() const { return removed_families; };
+  // Get the owned leaf ranges sent to the other processes
+  const std::vector<MigratedRange>& getSentRanges() const { return sent_ranges; };
+  // Get the owned leaf ranges received from the other processes
+  const std::vector<MigratedRange>& getReceivedRanges() const { return received_ranges; };
+  // Check if no change was recorded
+  bool empty() const;
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Remove the recorded changes
+  void clear();
+  // Sort the families along the SFC (parents before their descendants)
+  void sortFamilies();
+  // Record the owned leaf ranges migrated by a repartition given the number of owned leaves of each process before and
+  // after it (the owned leaves keep their global SFC order)
+  void addMigratedRanges(const std::vector<unsigned> &old_counts, const std::vector<unsigned> &new_counts, const unsigned rank);
+  // Record the family of a new oct
+  void octAllocated(const OctType &oct) override;
+  // Record the family of an oct about to be released
+  void octReleased(const OctType &oct) override;
+};
+
+#include "AdaptationLog.tpp"
@@ -0,0 +1,81 @@
+#include "AdaptationLog.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor (the root cells must outlive the log)
+template<typename CellType, typename TreeIteratorType>
+AdaptationLog<CellType, TreeIteratorType>::AdaptationLog(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
+: iterator(root_cells, max_level) {}
+
+
+//***********************************************************//
+//  ACCESSORS                                                //
+//***********************************************************//
+
+// Check if no change was recorded
+template<typename CellType, typename TreeIteratorType>
+bool AdaptationLog<CellType, TreeIteratorType>::empty() const {
+  return created_families.empty() && removed_families.empty() && sent_ranges.empty() && received_ranges.empty();
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Remove the recorded changes
+template<typename CellType, typename TreeIteratorType>
+void AdaptationLog<CellType, TreeIteratorType>::clear() {
+  created_families.clear();
+  removed_families.clear();
+  sent_ranges.clear();
+  received_ranges.clear();
+}
+
+// Sort the families along the SFC (the level is stored in the low bits of the key so parents come first)
+template<typename CellType, typename TreeIteratorType>
+void AdaptationLog<CellType, TreeIteratorType>::sortFamilies() {
+  std::sort(created_families.begin(), created_families.end());
+  std::sort(removed_families.begin(), removed_families.end());
+}
+
+// Record the owned leaf ranges migrated by a repartition given the number of owned leaves of each process before and
+// after it (the owned leaves keep their global SFC order)
+template<typename CellType, typename TreeIteratorType>
+void AdaptationLog<CellType, TreeIteratorType>::addMigratedRanges(const std::vector<unsigned> &old_counts, const std::vector<unsigned> &new_counts, const unsigned rank) {
+  // Global SFC offsets of the partitions before and after
+  const unsigned size = old_counts.size();
+  std::vector<std::size_t> old_offsets(size+1, 0), new_offsets(size+1, 0);
+  for (unsigned p{0}; p<size; ++p) {
+    old_offsets[p+1] = old_offsets[p] + old_counts[p];
+    new_offsets[p+1] = new_offsets[p] + new_counts[p];
+  }
+
+  // Overlaps of the old partition with the new partitions of the other processes and conversely
+  for (unsigned p{0}; p<size; ++p) {
+    if (p == rank)
+      continue;
+    std::size_t begin = std::max(old_offsets[rank], new_offsets[p]),
+                end   = std::min(old_offsets[rank+1], new_offsets[p+1]);
+    if (begin < end)
+      sent_ranges.push_back(MigratedRange{p, static_cast<unsigned>(begin - old_offsets[rank]), static_cast<unsigned>(end - begin)});
+    begin = std::max(old_offsets[p], new_offsets[rank]);
+    end   = std::min(old_offsets[p+1], new_offsets[rank+1]);
+    if (begin < end)
+      received_ranges.push_back(MigratedRange{p, static_cast<unsigned>(begin - new_offsets[rank]), static_cast<unsigned>(end - begin)});
+  }
+}
+
+// Record the family of a new oct
+template<typename CellType, typename TreeIteratorType>
+void AdaptationLog<CellType, TreeIteratorType>::octAllocated(const OctType &oct) {
+  created_families.push_back(iterator.getCellKey(oct.getParentCell()));
+}
+
+// Record the family of an oct about to be released
+template<typename CellType, typename TreeIteratorType>
+void AdaptationLog<CellType, TreeIteratorType>::octReleased(const OctType &oct) {
+  removed_families.push_back(iterator.getCellKey(oct.getParentCell()));
+}
@@ -8,55 +8,91 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <memory>
 #include <tuple>
-#include <unordered_set>
 
 #include "ChildAndDirectionTables.h"
 
 template<int NX, int NY, int NZ, typename DataType> class Cell;
 
 #include "CellData.h"
+#include "CellDataTraits.h"
 #include "Oct.h"
+#include "OctAllocator.h"
+#include "iterator/NeighborLeafRange.h"
 
 template<int NX = 2, int NY = 0, int NZ = 0, typename DataType = CellData>
-class Cell {
+class Cell : public std::enable_shared_from_this<Cell<NX, NY, NZ, DataType>> {
  public:
   static constexpr int Nx = NX;
   static constexpr int Ny = NY;
   static constexpr int Nz = NZ;
   using CellDataType = DataType;
   using ChildAndDirectionTablesType = ChildAndDirectionTables<Nx, Ny, Nz>;
+  using AllDirectionsType = typename ChildAndDirectionTablesType::AllDirectionsType;
+  using DirChildCellsType = FixedCapacityList<Cell<Nx, Ny, Nz, DataType>*, ChildAndDirectionTablesType::max_number_dir_children>;
   using ExtrapolationFunctionType = std::function<void(const std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>&)>;
   using InterpolationFunctionType = std::function<void(const std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>&)>;
+  using NeighborLeafRangeType = NeighborLeafRange<Cell<Nx, Ny, Nz, DataType>>;
   using OctType = Oct<Cell<Nx, Ny, Nz, DataType>>;
+  using OctAllocatorType = OctAllocator<Cell<Nx, Ny, Nz, DataType>>;
+  // Deleter of the cell data (data created inside an oct block is destroyed but not freed)
+  struct CellDataDeleter {
+    bool in_block = false;
+    void operator()(DataType *ptr) const {
+      if (in_block)
+        ptr->~DataType();
+      else
+        delete ptr;
+    }
+  };
+  using CellDataPtrType = std::unique_ptr<DataType, CellDataDeleter>;
   static constexpr unsigned number_dimensions = ChildAndDirectionTablesType::number_dimensions;
   static constexpr unsigned number_split_dimensions = ChildAndDirectionTablesType::number_split_dimensions;
   static constexpr unsigned number_neighbors = ChildAndDirectionTablesType::number_neighbors;
   static constexpr unsigned number_plane_neighbors = ChildAndDirectionTablesType::number_plane_neighbors;
   static constexpr unsigned number_volume_neighbors = ChildAndDirectionTablesType::number_volume_neighbors;
   static constexpr unsigned number_children = ChildAndDirectionTablesType::number_children;
+  // Only leaf cells hold data (see CellDataTraits)
+  static constexpr bool leaf_only_data = CellDataTraits<DataType>::leaf_only;
 
   //***********************************************************//
   //  VARIABLES                                                //
   //***********************************************************//
  private:
-  std::unique_ptr<DataType> data;
-  std::shared_ptr<OctType> parent_oct;
+  CellDataPtrType data;
+  // Parent oct (non-owning, the cell lives in the parent oct block)
+  OctType *parent_oct;
+  // Child oct (shares the ownership of the block holding the child oct, the child cells and their data with the child
+  // cell handles)
   std::shared_ptr<OctType> child_oct;
-  // Cell flags indicator
-	// - 0 : BELONG TO THIS  PROC  &  DOESN'T NEED TO BE CHANGED
-	// - 1 : BELONG TO THIS  PROC  &  NEED TO BE REFINED
-	// - 2 : BELONG TO THIS  PROC  &  NEED TO BE COARSENED
-	// - 3 : BELONG TO OTHER PROC  &  DOESN'T NEED TO BE CHANGED
-	// - 4 : BELONG TO OTHER PROC  &  NEED TO BE REFINED
-	// - 5 : BELONG TO OTHER PROC  &  NEED TO BE COARSENED
-	// - 6 : IS BOUNDARY CELL      &  DOESN'T NEED TO BE CHANGED
-	// - 7 : IS BOUNDARY CELL      &  NEED TO BE REFINED
-	// - 8 : IS BOUNDARY CELL      &  NEED TO BE COARSENED
-  int indicator;
+  // Packed cell header (constant time level, sibling number and root lookups)
+  struct CellHeader {
+    // Index of the root cell of the tree the cell belongs to
+    unsigned root_index;
+    // Level of the cell
+    unsigned char level;
+    // Position of the cell in the parent oct child_cells array
+    unsigned char sibling_number;
+    // Cell flags indicator
+    // - 0 : BELONG TO THIS  PROC  &  DOESN'T NEED TO BE CHANGED
+    // - 1 : BELONG TO THIS  PROC  &  NEED TO BE REFINED
+    // - 2 : BELONG TO THIS  PROC  &  NEED TO BE COARSENED
+    // - 3 : BELONG TO OTHER PROC  &  DOESN'T NEED TO BE CHANGED
+    // - 4 : BELONG TO OTHER PROC  &  NEED TO BE REFINED
+    // - 5 : BELONG TO OTHER PROC  &  NEED TO BE COARSENED
+    // - 6 : IS BOUNDARY CELL      &  DOESN'T NEED TO BE CHANGED
+    // - 7 : IS BOUNDARY CELL      &  NEED TO BE REFINED
+    // - 8 : IS BOUNDARY CELL      &  NEED TO BE COARSENED
+    signed char indicator;
+    // Keep the data when the cell is split (leaf-only data mode)
+    bool keep_data;
+  } header;
+  // Allocator used for creating child octs (make_shared is used if null)
+  OctAllocatorType *oct_allocator;
 
   //***********************************************************//
   //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
@@ -65,7 +101,9 @@ class Cell {
   // Constructor
   Cell();
   // Constructor (parent_oct=nullptr for root cell)
-  Cell(std::shared_ptr<OctType> parent_oct, int indicator=0);
+  Cell(OctType *parent_oct, int indicator=0);
+  // Constructor with already created data (used by the oct allocator)
+  Cell(OctType *parent_oct, int indicator, CellDataPtrType &&data, const unsigned sibling_number = 0);
   // Destructor
   ~Cell();
   // Clear cell
@@ -78,45 +116,65 @@ class Cell {
   //***********************************************************//
  public:
   // Get child oct
-  std::shared_ptr<OctType> getChildOct() const;
-  // Get a specific child cell
-  std::shared_ptr<Cell> getChildCell(const unsigned sibling_number) const;
+  OctType* getChildOct() const;
+  // Get a specific child cell (reference to the handle stored in the child oct)
+  const std::shared_ptr<Cell>& getChildCell(const unsigned sibling_number) const;
   // Get child cells
   const std::array<std::shared_ptr<Cell>, number_children>& getChildCells() const;
   // Get child cells in a specific direction
-  const std::vector<std::shared_ptr<Cell>> getDirChildCells(const unsigned dir) const;
+  DirChildCellsType getDirChildCells(const unsigned dir) const;
   // Get level of the cell
   unsigned getLevel() const;
   // Get parent oct
-  std::shared_ptr<OctType> getParentOct() const;
+  OctType* getParentOct() const;
   // Get the sibling number (position of the cell in the parent oct child_cells array)
   unsigned getSiblingNumber() const;
+  // Get the index of the root cell of the tree
+  unsigned getRootIndex() const { return header.root_index; };
   // Get cell data
   DataType& getCellData() const { return *data; };
+  // True if the cell holds data (always true unless leaf-only data mode)
+  bool hasCellData() const { return static_cast<bool>(data); };
+  // True if the cell keeps its data when split (leaf-only data mode)
+  bool keepsCellData() const { return header.keep_data; };
   // Get the computation load of the cell
   double getLoad() const;
-  // Flags accessors
-  bool belongToThisProc() const  { return (indicator < 3); }
-  bool belongToOtherProc() const { return (indicator >= 3) && (indicator < 6); }
-  bool isBoundaryCell() const    { return (indicator >= 6); }
-  bool isToRefine() const        { return (indicator%3) == 1; }
-  bool isToCoarse() const        { return (indicator%3) == 2; }
- private:
-  // Get the cell as a smart pointer for referencing
+  // Get the allocator used for creating child octs
+  OctAllocatorType* getOctAllocator() const { return oct_allocator; };
+  // Get the cell as a smart pointer (for callbacks taking shared_ptr, a stored handle keeps the cell memory alive after
+  // coarsening)
   std::shared_ptr<Cell> thisAsSmartPtr() const;
+  // Flags accessors
+  bool belongToThisProc() const  { return (header.indicator < 3); }
+  bool belongToOtherProc() const { return (header.indicator >= 3) && (header.indicator < 6); }
+  bool isBoundaryCell() const    { return (header.indicator >= 6); }
+  bool isToRefine() const        { return (header.indicator%3) == 1; }
+  bool isToCoarse() const        { return (header.indicator%3) == 2; }
 
   //***********************************************************//
 	//  MUTATORS                                                 //
 	//***********************************************************//
  public:
   // Set cell data
-  void setCellData(std::unique_ptr<DataType> &&new_data) { data = std::move(new_data); };
+  void setCellData(std::unique_ptr<DataType> &&new_data) { data = CellDataPtrType(new_data.release(), CellDataDeleter{false}); };
+  // Create default data if the cell holds none (leaf-only data mode)
+  void allocateCellData() { if (!data) data = CellDataPtrType(new DataType(), CellDataDeleter{false}); };
+  // Create default data for the non-leaf child cells before an extrapolation function (leaf-only data mode)
+  void allocateChildCellData() const;
+  // Release the data of the cell and of its non-leaf descendants once extrapolated to the leaves (leaf-only data mode)
+  void releaseInternalCellData();
+  // Keep the data when the cell is split (leaf-only data mode)
+  void setKeepCellData(const bool keep) { header.keep_data = keep; };
+  // Set the allocator used for creating child octs
+  void setOctAllocator(OctAllocatorType *allocator) { oct_allocator = allocator; };
+  // Set the index of the root cell of the tree (only for root cells, propagated to descendants at split)
+  void setRootIndex(const unsigned root_index);
   // Flags mutators
-  void setToThisProc()  { indicator = indicator%3; }
-  void setToOtherProc() { indicator = 3 + indicator%3; }
-  void setToUnchange()  { indicator = indicator - (indicator%3); }
-  void setToRefine()    { indicator = indicator + 1 - (indicator%3); }
-  void setToCoarse()    { indicator = indicator + 2 - (indicator%3); }
+  void setToThisProc()  { header.indicator = header.indicator%3; }
+  void setToOtherProc() { header.indicator = 3 + header.indicator%3; }
+  void setToUnchange()  { header.indicator = header.indicator - (header.indicator%3); }
+  void setToRefine()    { header.indicator = header.indicator + 1 - (header.indicator%3); }
+  void setToCoarse()    { header.indicator = header.indicator + 2 - (header.indicator%3); }
   void setToThisProcRecurs() {
     setToThisProc();
     if (!isLeaf())
@@ -148,7 +206,9 @@ class Cell {
         child->setToCoarseRecurs();
   }
  private:
-  bool setToBoundary() { return indicator = 6+indicator%3; }
+  bool setToBoundary() { return header.indicator = 6+header.indicator%3; }
+  // Set the index of the root cell to the cell and its descendants
+  void setRootIndexRecurs(const unsigned root_index);
 
   //***********************************************************//
   //  METHODS                                                  //
@@ -170,6 +230,14 @@ class Cell {
   const std::array<std::shared_ptr<Cell>, number_children>& split(const unsigned max_level, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<Cell> &cell) { (void)cell; });
   // Coarsen a cell if neighbors cell allow to preserve consistency else nothing is done
   bool coarsen(const unsigned min_level, InterpolationFunctionType interpolation_function = [](const std::shared_ptr<Cell> &cell) { (void)cell; });
+  // Verify if children coarsening is needed before cell coarsening
+  bool verifyCoarsenChildren() const;
+  // Verify if neighbors coarsening is needed before cell coarsening
+  bool verifyCoarsenNeighbors() const;
+  // Call the interpolation function before removing the child cells (coarsening steps, see coarsen)
+  void interpolateFromChildren(InterpolationFunctionType interpolation_function);
+  // Remove the child cells without verification (coarsening steps, see coarsen)
+  void removeChildCells();
   //┌────────────┬──────────────────┬──────────────────────────────────┐
   //│  Priority  │   Available if   │   Indexes (dir)                  │
   //├────────────┼──────────────────┼──────────────────────────────────┤
@@ -203,27 +271,30 @@ class Cell {
   //│  +X +Y +Z  │  Nx>0 Ny>0 Nz>0  │                                  │
   //└────────────┴──────────────────┴──────────────────────────────────┘
   // Get a pointer to a neighbor cell
-  std::shared_ptr<Cell> getNeighborCell(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors = nullptr) const;
+  Cell* getNeighborCell(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors = nullptr) const;
   // Get a pointer to a neighbor cell and save it  to array for reuse
   // If the neighbor was already computed, extract from cached_neighbors array
-  std::shared_ptr<Cell> getNeighborCellAndSave(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors = nullptr) const;
-  // Loop on all neighbor cells and apply a function
-  void applyToNeighborCells(const std::function<void(const std::shared_ptr<Cell>&, const std::shared_ptr<Cell>&, const unsigned&)> &&f, const bool only_once=false, const bool skip_null=false, const std::vector<int> &directions = ChildAndDirectionTablesType::all_directions) const;
+  Cell* getNeighborCellAndSave(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors = nullptr) const;
+  // Loop on all neighbor cells and apply a function (any callable taking the cell, the neighbor and the direction) in
+  // a list of directions (any range of directions)
+  template<typename Function, typename DirectionsType = AllDirectionsType>
+  void applyToNeighborCells(Function &&f, const bool only_once=false, const bool skip_null=false, const DirectionsType &directions = ChildAndDirectionTablesType::all_directions) const;
   // Loop on all neighbor leaf cells in a specific direction and apply a function
-  void applyToDirNeighborLeafCells(const unsigned dir, const std::function<void(const std::shared_ptr<Cell>&, const std::shared_ptr<Cell>&, const unsigned&)> &&f) const;
+  template<typename Function>
+  void applyToDirNeighborLeafCells(const unsigned dir, Function &&f) const;
   // Loop on all neighbor leaf cells and apply a function
-  void applyToNeighborLeafCells(const std::function<void(const std::shared_ptr<Cell>&, const std::shared_ptr<Cell>&, const unsigned&)> &&f, const bool only_once=false, const bool skip_null=false, const std::vector<int> &directions = ChildAndDirectionTablesType::all_directions) const;
+  template<typename Function, typename DirectionsType = AllDirectionsType>
+  void applyToNeighborLeafCells(Function &&f, const bool only_once=false, const bool skip_null=false, const DirectionsType &directions = ChildAndDirectionTablesType::all_directions) const;
+  // Range of the neighbor leaf cells (null neighbors are skipped)
+  template<typename DirectionsType = AllDirectionsType>
+  NeighborLeafRangeType neighborLeaves(const DirectionsType &directions = ChildAndDirectionTablesType::all_directions) const { return NeighborLeafRangeType(*this, directions); };
   //Apply extrapolation function to all non-leaf descendent cells recursively
   void extrapolateRecursively(ExtrapolationFunctionType extrapolation_function) const;
  private:
   // Verify if neighbors splitting is needed before cell splitting
   bool verifySplitNeighbors(const unsigned max_level);
-  // Split neighbors first if needed before cell splitting
-  void checkSplitNeighbors(const unsigned max_level, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<Cell> &cell) { (void)cell; });
-  // Verify if children coarsening is needed before cell coarsening
-  bool verifyCoarsenChildren();
-  // Verify if neighbors coarsening is needed before cell coarsening
-  bool verifyCoarsenNeighbors();
+  // Split neighbors first if needed before cell splitting and get the neighbor cells
+  std::array<Cell*, number_neighbors> checkSplitNeighbors(const unsigned max_level, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<Cell> &cell) { (void)cell; });
  public:
  // Transform sibling number to (i,j,k) coordinates
   static std::tuple<unsigned, unsigned, unsigned> siblingNumberToCoords(const unsigned sibling_number) { return ChildAndDirectionTablesType::siblingNumberToCoords(sibling_number); };
@@ -237,9 +308,9 @@ class Cell {
   // convert two direct neighbor directions to a plane direction
   static int directToPlaneDir(const int dir1, const int dir2) { return ChildAndDirectionTablesType::directToPlaneDir(dir1, dir2); };
   // Get a pointer to a neighbor cell accessible by 2 consecutive othogonal direction (corners in 2D)
-  std::shared_ptr<Cell> getPlaneNeighborCell(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors) const;
+  Cell* getPlaneNeighborCell(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors) const;
   // Get a pointer to a neighbor cell accessible by 3 consecutive othogonal direction (corners in 3D)
-  std::shared_ptr<Cell> getVolumeNeighborCell(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors) const;
+  Cell* getVolumeNeighborCell(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors) const;
   // Flags propagation from parent to children
   void setIndicatorFromParent(const Cell &parent_cell);
 };
@@ -7,23 +7,36 @@
 // Constructor
 template<int Nx, int Ny, int Nz, typename DataType>
 Cell<Nx, Ny, Nz, DataType>::Cell()
-: data() {
-  data = std::make_unique<DataType>();
-  indicator = 0;
-}
+: data(new DataType(), CellDataDeleter{false}),
+  parent_oct(nullptr),
+  header{0, 0, 0, 0, false},
+  oct_allocator(nullptr) {}
 
 // Constructor (parent_oct=nullptr for root cell)
 template<int Nx, int Ny, int Nz, typename DataType>
-Cell<Nx, Ny, Nz, DataType>::Cell(std::shared_ptr<OctType> parent_oct, int indicator)
-: indicator(indicator) {
-  data = std::make_unique<DataType>();
-  this->parent_oct = parent_oct;
-  child_oct.reset();
+Cell<Nx, Ny, Nz, DataType>::Cell(OctType *parent_oct, int indicator)
+: Cell(parent_oct, indicator, CellDataPtrType(new DataType(), CellDataDeleter{false})) {}
+
+// Constructor with already created data (used by the oct allocator)
+template<int Nx, int Ny, int Nz, typename DataType>
+Cell<Nx, Ny, Nz, DataType>::Cell(OctType *parent_oct, int indicator, CellDataPtrType &&data, const unsigned sibling_number)
+: data(std::move(data)),
+  parent_oct(parent_oct),
+  header{0, 0, static_cast<unsigned char>(sibling_number), static_cast<signed char>(indicator), false},
+  oct_allocator(nullptr) {
+  if (parent_oct) {
+    header.level = static_cast<unsigned char>(parent_oct->getLevel());
+    if (parent_oct->getParentCell())
+      header.root_index = parent_oct->getParentCell()->getRootIndex();
+  }
 }
 
-// Destructor
+// Destructor (the child cell handles share the ownership of the child oct block)
 template<int Nx, int Ny, int Nz, typename DataType>
-Cell<Nx, Ny, Nz, DataType>::~Cell() {};
+Cell<Nx, Ny, Nz, DataType>::~Cell() {
+  if (child_oct)
+    child_oct->clear();
+};
 
 // Clear Cell
 template<int Nx, int Ny, int Nz, typename DataType>
@@ -37,7 +50,7 @@ void Cell<Nx, Ny, Nz, DataType>::clear() {
 template<int Nx, int Ny, int Nz, typename DataType>
 void Cell<Nx, Ny, Nz, DataType>::reset() {
   data.reset();
-  parent_oct.reset();
+  parent_oct = nullptr;
   if (child_oct)
     child_oct.reset();
 }
@@ -49,16 +62,19 @@ void Cell<Nx, Ny, Nz, DataType>::reset() {
 
 // Get child oct
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<typename Cell<Nx, Ny, Nz, DataType>::OctType> Cell<Nx, Ny, Nz, DataType>::getChildOct() const {
-  return child_oct;
+typename Cell<Nx, Ny, Nz, DataType>::OctType* Cell<Nx, Ny, Nz, DataType>::getChildOct() const {
+  return child_oct.get();
 };
 
 // Get a specific child cell
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getChildCell(const unsigned sibling_number) const {
+const std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>& Cell<Nx, Ny, Nz, DataType>::getChildCell(const unsigned sibling_number) const {
+  static const std::shared_ptr<Cell> null_cell;
+  if (sibling_number>=number_children)
+    throw std::runtime_error("Invalid sibling number in Cell::getChildCell()");
   if (!isLeaf())
-    return getChildOct()->getChildCell(sibling_number);
-  return nullptr;
+    return child_oct->getChildCells()[sibling_number];
+  return null_cell;
 };
 
 // Get child cells
@@ -69,16 +85,15 @@ const std::array<std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>, Cell<Nx, Ny, Nz, D
 
 // Get child cells in a specific direction
 template<int Nx, int Ny, int Nz, typename DataType>
-const std::vector<std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>> Cell<Nx, Ny, Nz, DataType>::getDirChildCells(const unsigned dir) const {
+typename Cell<Nx, Ny, Nz, DataType>::DirChildCellsType Cell<Nx, Ny, Nz, DataType>::getDirChildCells(const unsigned dir) const {
   if (isLeaf())
     throw std::runtime_error("Cannot call on leaf in Cell::getDirChildCells()");
 
   if ((dir >= 0) && (dir < number_volume_neighbors)) {
     const auto &child_cells = getChildCells();
-    const auto &dir_sibling_numbers = ChildAndDirectionTablesType::dir_sibling_numbers[dir];
-    std::vector<std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>> dir_child_cells(dir_sibling_numbers.size());
-    for (size_t i{0}; i<dir_sibling_numbers.size(); ++i)
-      dir_child_cells[i] = child_cells[dir_sibling_numbers[i]];
+    DirChildCellsType dir_child_cells;
+    for (const unsigned sibling_number : ChildAndDirectionTablesType::dir_sibling_numbers[dir])
+      dir_child_cells.push_back(child_cells[sibling_number].get());
     return dir_child_cells;
   }
 
@@ -88,12 +103,12 @@ const std::vector<std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>> Cell<Nx, Ny, Nz,
 // Get level of the cell
 template<int Nx, int Ny, int Nz, typename DataType>
 unsigned Cell<Nx, Ny, Nz, DataType>::getLevel() const {
-  return (!isRoot() ? parent_oct->getLevel() : 0);
+  return header.level;
 }
 
 // Get parent oct
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<typename Cell<Nx, Ny, Nz, DataType>::OctType> Cell<Nx, Ny, Nz, DataType>::getParentOct() const {
+typename Cell<Nx, Ny, Nz, DataType>::OctType* Cell<Nx, Ny, Nz, DataType>::getParentOct() const {
   return parent_oct;
 };
 
@@ -101,24 +116,72 @@ std::shared_ptr<typename Cell<Nx, Ny, Nz, DataType>::OctType> Cell<Nx, Ny, Nz, D
 template<int Nx, int Ny, int Nz, typename DataType>
 unsigned Cell<Nx, Ny, Nz, DataType>::getSiblingNumber() const {
   if (parent_oct)
-    return parent_oct->getSiblingNumber(this);
+    return header.sibling_number;
   throw std::runtime_error("No parent Oct in Cell::getSiblingNumber()");
 }
 
 // Get the computation load of the cell
 template<int Nx, int Ny, int Nz, typename DataType>
 double Cell<Nx, Ny, Nz, DataType>::getLoad() const {
+  if (!data)
+    return 0.;
   return data->getLoad(isLeaf(), std::static_pointer_cast<void>(thisAsSmartPtr()));
 }
 
-// Get the cell as a smart pointer for referencing
+// Get the cell as a smart pointer (for callbacks taking shared_ptr)
 template<int Nx, int Ny, int Nz, typename DataType>
 std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::thisAsSmartPtr() const {
-  if (!isLeaf())
-    return child_oct->getParentCell();
   if (!isRoot())
-    return parent_oct->getChildCell(getSiblingNumber());
-  throw std::runtime_error("No child/parent Oct in Cell::thisAsSmartPtr()");
+    return parent_oct->getChildCells()[getSiblingNumber()];
+  std::shared_ptr<Cell> root_cell = std::const_pointer_cast<Cell>(this->weak_from_this().lock());
+  if (!root_cell)
+    throw std::runtime_error("Root cell not owned by a shared_ptr in Cell::thisAsSmartPtr()");
+  return root_cell;
+}
+
+
+//***********************************************************//
+//  MUTATORS                                                 //
+//***********************************************************//
+
+// Create default data for the non-leaf child cells before an extrapolation function (leaf-only data mode)
+template<int Nx, int Ny, int Nz, typename DataType>
+void Cell<Nx, Ny, Nz, DataType>::allocateChildCellData() const {
+  if constexpr (leaf_only_data)
+    if (!isLeaf())
+      for (const auto &child : getChildCells())
+        if (!child->isLeaf())
+          child->allocateCellData();
+}
+
+// Release the data of the cell and of its non-leaf descendants once extrapolated to the leaves (leaf-only data mode)
+template<int Nx, int Ny, int Nz, typename DataType>
+void Cell<Nx, Ny, Nz, DataType>::releaseInternalCellData() {
+  if constexpr (leaf_only_data) {
+    header.keep_data = false;
+    if (isLeaf())
+      return;
+    data.reset();
+    for (const auto &child : getChildCells())
+      child->releaseInternalCellData();
+  }
+}
+
+// Set the index of the root cell of the tree (only for root cells, propagated to descendants at split)
+template<int Nx, int Ny, int Nz, typename DataType>
+void Cell<Nx, Ny, Nz, DataType>::setRootIndex(const unsigned root_index) {
+  if (!isRoot())
+    throw std::runtime_error("Can be call only on root in Cell::setRootIndex()");
+  setRootIndexRecurs(root_index);
+}
+
+// Set the index of the root cell to the cell and its descendants
+template<int Nx, int Ny, int Nz, typename DataType>
+void Cell<Nx, Ny, Nz, DataType>::setRootIndexRecurs(const unsigned root_index) {
+  header.root_index = root_index;
+  if (!isLeaf())
+    for (const auto &child : getChildCells())
+      child->setRootIndexRecurs(root_index);
 }
 
 
@@ -186,13 +249,12 @@ const std::array<std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>, Cell<Nx, Ny, Nz, D
   if (!isRoot())
     throw std::runtime_error("Can be call only on root in Cell::splitRoot()");
 
-  // Split normally
-  split(max_level);
-
-  child_oct->setParentCell(root_cell);
-
-  // Call extrapolation function
-  extrapolation_function(root_cell);
+  // Split normally (the extrapolation function is called before the root data is released)
+  split(max_level, [this, &root_cell, &extrapolation_function](const std::shared_ptr<Cell> &cell) {
+    (void)cell;
+    child_oct->setParentCell(root_cell.get());
+    extrapolation_function(root_cell);
+  });
 
   return child_oct->getChildCells();
 }
@@ -205,28 +267,31 @@ const std::array<std::shared_ptr<Cell<Nx, Ny, Nz, DataType>>, Cell<Nx, Ny, Nz, D
 
   // We check if the neighbors are at level superior or equal to
   // prLvl, if not we refine them first
-  checkSplitNeighbors(getLevel() + 1, extrapolation_function);
+  const std::array<Cell*, number_neighbors> neighbor_cells = checkSplitNeighbors(getLevel() + 1, extrapolation_function);
+
+  // Initialize oct and child cells (in a single block if an allocator is available)
+  std::shared_ptr<OctType> oct = oct_allocator ? oct_allocator->allocateOct(this, getLevel() + 1, header.indicator)
+                                                : OctAllocatorType::makeOct(this, getLevel() + 1, header.indicator);
 
-  // Initialize oct and establish neighbors
-  std::shared_ptr oct = std::make_shared<OctType>();
-  oct->init(!isRoot() ? thisAsSmartPtr() : nullptr, getLevel() + 1);
+  // Establish neighbors
   if (!isRoot())
     for (unsigned dir{0}; dir<number_neighbors; ++dir)
-      oct->setNeighborCell(dir, getNeighborCell(dir));
+      oct->setNeighborCell(dir, neighbor_cells[dir]);
 
   // Make oct as child
   child_oct = oct;
 
-  std::shared_ptr<Cell> cell;
-  for (unsigned i{0}; i<number_children; ++i) {
-    cell = std::make_shared<Cell>(oct, indicator);
-    oct->setChildCell(i, cell);
+  for (const auto &cell : oct->getChildCells())
     cell->setToUnchange();
-  }
 
   // Call extrapolation function
   extrapolation_function(thisAsSmartPtr());
 
+  // Data moved to the child cells
+  if constexpr (leaf_only_data)
+    if (!header.keep_data)
+      data.reset();
+
   return child_oct->getChildCells();
 }
 
@@ -239,15 +304,31 @@ bool Cell<Nx, Ny, Nz, DataType>::coarsen(const unsigned min_level, Interpolation
   if (!verifyCoarsenChildren() || !verifyCoarsenNeighbors())
     return false;
 
+  interpolateFromChildren(interpolation_function);
+  removeChildCells();
+  return true;
+}
+
+// Call the interpolation function before removing the child cells
+template<int Nx, int Ny, int Nz, typename DataType>
+void Cell<Nx, Ny, Nz, DataType>::interpolateFromChildren(InterpolationFunctionType interpolation_function) {
+  // Data moved back from the child cells
+  if constexpr (leaf_only_data)
+    allocateCellData();
+
   // Call interpolation function
   interpolation_function(thisAsSmartPtr());
+}
 
+// Remove the child cells without verification
+template<int Nx, int Ny, int Nz, typename DataType>
+void Cell<Nx, Ny, Nz, DataType>::removeChildCells() {
   // Clear Oct and child cells
+  if (oct_allocator)
+    oct_allocator->releaseOct(*child_oct);
   child_oct->clear();
   child_oct.reset();
   setToUnchange();
-
-  return true;
 }
 
 //┌────────────┬──────────────────┬──────────────────────────────────┐
@@ -284,7 +365,7 @@ bool Cell<Nx, Ny, Nz, DataType>::coarsen(const unsigned min_level, Interpolation
 //└────────────┴──────────────────┴──────────────────────────────────┘
 // Get a pointer to a neighbor cell
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getNeighborCell(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors) const {
+Cell<Nx, Ny, Nz, DataType>* Cell<Nx, Ny, Nz, DataType>::getNeighborCell(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors) const {
   if (dir>=number_volume_neighbors)
     throw std::runtime_error("Invalid neighbor direction in Cell::getNeighborCell()");
 
@@ -297,13 +378,13 @@ std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getNeigh
   if (dir < number_neighbors) {
     const auto [neighbor_is_sibling, neighbor_sibling_number] = getDirectNeighborCellInfos(getSiblingNumber(), dir);
 
-    std::shared_ptr<Cell> neighbor_cell;
+    Cell *neighbor_cell;
     if (neighbor_is_sibling)
       neighbor_cell = this->parent_oct->getChildCell(neighbor_sibling_number);
     else {
       neighbor_cell = this->parent_oct->getNeighborCell(dir);
       if (neighbor_cell && !neighbor_cell->isLeaf())
-        neighbor_cell = neighbor_cell->getChildCell(neighbor_sibling_number);
+        neighbor_cell = neighbor_cell->getChildCell(neighbor_sibling_number).get();
     }
     return neighbor_cell;
   } else if (dir < number_plane_neighbors)
@@ -315,14 +396,13 @@ std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getNeigh
 // Get a pointer to a neighbor cell and save it  to array for reuse
 // If the neighbor was already computed, extract from cached_neighbors array
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getNeighborCellAndSave(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors) const {
-  // Check if direction already cached
-  std::shared_ptr<Cell> this_cell = thisAsSmartPtr();
-  if (cached_neighbors && dir < number_plane_neighbors && (*cached_neighbors)[dir] != this_cell)
+Cell<Nx, Ny, Nz, DataType>* Cell<Nx, Ny, Nz, DataType>::getNeighborCellAndSave(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors) const {
+  // Check if direction already cached (entries not computed yet point to this cell)
+  if (cached_neighbors && dir < number_plane_neighbors && (*cached_neighbors)[dir] != this)
     return (*cached_neighbors)[dir];
 
   // Compute neighbors
-  std::shared_ptr<Cell> neighbor_cell = getNeighborCell(dir, cached_neighbors);
+  Cell *neighbor_cell = getNeighborCell(dir, cached_neighbors);
 
   // Cache the neighbor cell
   if (cached_neighbors && dir < number_plane_neighbors)
@@ -331,65 +411,77 @@ std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getNeigh
   return neighbor_cell;
 };
 
-// Loop on all neighbor leaf cells and apply a function
+// Loop on all neighbor cells and apply a function (any callable taking the cell, the neighbor and the direction) in
+// a list of directions (any range of directions)
 template<int Nx, int Ny, int Nz, typename DataType>
-void Cell<Nx, Ny, Nz, DataType>::applyToNeighborCells(const std::function<void(const std::shared_ptr<Cell>&, const std::shared_ptr<Cell>&, const unsigned&)> &&f, const bool only_once, const bool skip_null, const std::vector<int> &directions) const {
+template<typename Function, typename DirectionsType>
+void Cell<Nx, Ny, Nz, DataType>::applyToNeighborCells(Function &&f, const bool only_once, const bool skip_null, const DirectionsType &directions) const {
   // If a neighbor is used more than once in the process it can be retrived from this array
-  std::array<std::shared_ptr<Cell>, number_plane_neighbors> cached_neighbors;
-  cached_neighbors.fill(thisAsSmartPtr());
+  std::array<Cell*, number_plane_neighbors> cached_neighbors;
+  cached_neighbors.fill(const_cast<Cell*>(this));
+
+  // Cells already seen (only when each neighbor is visited once)
+  std::array<Cell*, ChildAndDirectionTablesType::number_of_directions> cell_already_seen;
+  unsigned number_cell_already_seen{0};
 
-  // Cells already seen are saved in this set
-  std::unordered_set<Cell*> cell_already_seen;
-  cell_already_seen.reserve(ChildAndDirectionTablesType::max_number_neighbor_leaf_cells);
+  // Smart pointer handed to the callback
+  const std::shared_ptr<Cell> this_cell = thisAsSmartPtr();
 
   // Loop through all directions
   for (const unsigned dir : directions) {
     // Get the neighbor cell
-    std::shared_ptr<Cell> neighbor = getNeighborCellAndSave(dir, &cached_neighbors);
+    Cell *neighbor = getNeighborCellAndSave(dir, &cached_neighbors);
 
     // No neighbor cell in this direction
     if (!neighbor) {
       if (!skip_null)
-        f(thisAsSmartPtr(), nullptr, dir);
+        f(this_cell, nullptr, dir);
       continue;
     }
 
-    // The neighbor leaf cell has the same level
-    if (neighbor->isLeaf()) {
-      if (!only_once || !cell_already_seen.count(neighbor.get()))
-        f(thisAsSmartPtr(), neighbor, dir);
-      else if (only_once && !cell_already_seen.count(neighbor.get()))
-        cell_already_seen.insert(neighbor.get());
+    // Neighbor cell already visited in another direction
+    if (only_once) {
+      if (std::find(cell_already_seen.begin(), cell_already_seen.begin()+number_cell_already_seen, neighbor) != cell_already_seen.begin()+number_cell_already_seen)
+        continue;
+      cell_already_seen[number_cell_already_seen++] = neighbor;
     }
+
+    f(this_cell, neighbor->thisAsSmartPtr(), dir);
   }
 }
 
 // Loop on all neighbor leaf cells in a specific direction and apply a function
 template<int Nx, int Ny, int Nz, typename DataType>
-void Cell<Nx, Ny, Nz, DataType>::applyToDirNeighborLeafCells(const unsigned dir, const std::function<void(const std::shared_ptr<Cell>&, const std::shared_ptr<Cell>&, const unsigned&)> &&f) const {
+template<typename Function>
+void Cell<Nx, Ny, Nz, DataType>::applyToDirNeighborLeafCells(const unsigned dir, Function &&f) const {
   // Get the neighbor cell
-  std::shared_ptr<Cell> neighbor = getNeighborCell(dir);
+  Cell *neighbor = getNeighborCell(dir);
+
+  // Smart pointer handed to the callback
+  const std::shared_ptr<Cell> this_cell = thisAsSmartPtr();
 
   // No neighbor cell in this direction
   if (!neighbor) {
-    f(thisAsSmartPtr(), nullptr, dir);
+    f(this_cell, nullptr, dir);
     return;
   }
 
   // The neighbor leaf cell has the same level
   if (neighbor->isLeaf()) {
-    f(thisAsSmartPtr(), neighbor, dir);
+    f(this_cell, neighbor->thisAsSmartPtr(), dir);
     return;
   }
 
   // The neighbor cell is higher level so we loop on its children
-  for (const auto &neighbor_child_cell : neighbor->getDirChildCells(dir))
-    f(thisAsSmartPtr(), neighbor_child_cell, dir);
+  const auto &neighbor_child_cells = neighbor->getChildCells();
+  for (const unsigned sibling_number : ChildAndDirectionTablesType::dir_sibling_numbers[dir])
+    f(this_cell, neighbor_child_cells[sibling_number], dir);
 }
 
 // Loop on all neighbor leaf cells and apply a function
 template<int Nx, int Ny, int Nz, typename DataType>
-void Cell<Nx, Ny, Nz, DataType>::applyToNeighborLeafCells(const std::function<void(const std::shared_ptr<Cell>&, const std::shared_ptr<Cell>&, const unsigned&)> &&f, const bool only_once, const bool skip_null, const std::vector<int> &directions) const {
+template<typename Function, typename DirectionsType>
+void Cell<Nx, Ny, Nz, DataType>::applyToNeighborLeafCells(Function &&f, const bool only_once, const bool skip_null, const DirectionsType &directions) const {
   applyToNeighborCells(
     [&f](const std::shared_ptr<Cell> &c, const std::shared_ptr<Cell> &n, const unsigned &dir) {
       // No neighbor cell in this direction
@@ -405,9 +497,9 @@ void Cell<Nx, Ny, Nz, DataType>::applyToNeighborLeafCells(const std::function<vo
       }
 
       // The neighbor cell is higher level so we loop on its children
-      for (const auto &neighbor_child_cell : n->getDirChildCells(dir)) {
-        f(c, neighbor_child_cell, dir);
-      }
+      const auto &neighbor_child_cells = n->getChildCells();
+      for (const unsigned sibling_number : ChildAndDirectionTablesType::dir_sibling_numbers[dir])
+        f(c, neighbor_child_cells[sibling_number], dir);
     },
     only_once, // Only once per cell
     skip_null, // Skip nullptr values
@@ -421,6 +513,7 @@ void Cell<Nx, Ny, Nz, DataType>::extrapolateRecursively(ExtrapolationFunctionTyp
   if (isLeaf())
     return;
 
+  allocateChildCellData();
   extrapolation_function(thisAsSmartPtr());
 
   for (const auto &child : getChildCells())
@@ -441,28 +534,38 @@ bool Cell<Nx, Ny, Nz, DataType>::verifySplitNeighbors(const unsigned max_level)
   return true;
 }
 
-// Split neighbors first if needed before cell splitting
+// Split neighbors first if needed before cell splitting and get the neighbor cells
 template<int Nx, int Ny, int Nz, typename DataType>
-void Cell<Nx, Ny, Nz, DataType>::checkSplitNeighbors(const unsigned max_level, ExtrapolationFunctionType extrapolation_function) {
+std::array<Cell<Nx, Ny, Nz, DataType>*, Cell<Nx, Ny, Nz, DataType>::number_neighbors> Cell<Nx, Ny, Nz, DataType>::checkSplitNeighbors(const unsigned max_level, ExtrapolationFunctionType extrapolation_function) {
+  std::array<Cell*, number_neighbors> neighbor_cells{};
   if (isRoot())
-    return;
+    return neighbor_cells;
 
   // Assuming 4 connexity neighbor size consistency
+  bool neighbor_split{false};
   for (unsigned dir{0}; dir<number_neighbors; ++dir) {
-    auto neighbor_cell = getNeighborCell(dir);
-    if (neighbor_cell && neighbor_cell->getLevel()<getLevel() && neighbor_cell->isLeaf())
-      neighbor_cell->split(max_level, extrapolation_function);
+    neighbor_cells[dir] = getNeighborCell(dir);
+    if (neighbor_cells[dir] && neighbor_cells[dir]->getLevel()<getLevel() && neighbor_cells[dir]->isLeaf()) {
+      neighbor_cells[dir]->split(max_level, extrapolation_function);
+      neighbor_split = true;
+    }
   }
+
+  // A split may cascade to the neighbors of the other directions
+  if (neighbor_split)
+    for (unsigned dir{0}; dir<number_neighbors; ++dir)
+      neighbor_cells[dir] = getNeighborCell(dir);
+  return neighbor_cells;
 }
 
 // Verify if children coarsening is needed before cell coarsening
 template<int Nx, int Ny, int Nz, typename DataType>
-bool Cell<Nx, Ny, Nz, DataType>::verifyCoarsenChildren() {
+bool Cell<Nx, Ny, Nz, DataType>::verifyCoarsenChildren() const {
   if (isLeaf())
     return false;
 
   for (unsigned i{0}; i<number_children; ++i) {
-    auto child_cell = getChildCell(i);
+    const auto &child_cell = getChildCell(i);
     if (!child_cell->isLeaf())
       return false;
   }
@@ -471,14 +574,14 @@ bool Cell<Nx, Ny, Nz, DataType>::verifyCoarsenChildren() {
 
 // Verify if neighbors coarsening is needed before cell coarsening
 template<int Nx, int Ny, int Nz, typename DataType>
-bool Cell<Nx, Ny, Nz, DataType>::verifyCoarsenNeighbors() {
+bool Cell<Nx, Ny, Nz, DataType>::verifyCoarsenNeighbors() const {
   if (isLeaf())
     return false;
 
   // Get the neighbor cell
   for (unsigned dir{0}; dir<number_neighbors; ++dir) {
     // Get only the neighbor's children adjacent to the shared face (opposite direction)
-    std::shared_ptr<Cell> neighbor = getNeighborCell(dir);
+    Cell *neighbor = getNeighborCell(dir);
     if (!neighbor || neighbor->isLeaf())
       continue;
     // Verify the neighbor child cells are not split
@@ -493,18 +596,18 @@ bool Cell<Nx, Ny, Nz, DataType>::verifyCoarsenNeighbors() {
 
 // Get a pointer to a neighbor cell accessible by 2 consecutive othogonal direction (corners in 2D)
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getPlaneNeighborCell(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors) const {
+Cell<Nx, Ny, Nz, DataType>* Cell<Nx, Ny, Nz, DataType>::getPlaneNeighborCell(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors) const {
   // Split plane neighbor dir to 2 direct neighbor dirs
   const auto [dir1, dir2] = ChildAndDirectionTablesType::planeToDirectDirs(dir);
 
-  std::shared_ptr<Cell> neighbor_cell1 = getNeighborCellAndSave(dir1, cached_neighbors), neighbor_cell12;
+  Cell *neighbor_cell1 = getNeighborCellAndSave(dir1, cached_neighbors), *neighbor_cell12 = nullptr;
   if (neighbor_cell1) {
     neighbor_cell12 = neighbor_cell1->getNeighborCell(dir2);
     if (neighbor_cell1->getLevel() >= getLevel() && neighbor_cell12)
       return neighbor_cell12;
   }
 
-  std::shared_ptr<Cell> neighbor_cell2 = getNeighborCellAndSave(dir2, cached_neighbors), neighbor_cell21;
+  Cell *neighbor_cell2 = getNeighborCellAndSave(dir2, cached_neighbors), *neighbor_cell21 = nullptr;
   if (neighbor_cell2) {
     neighbor_cell21 = neighbor_cell2->getNeighborCell(dir1);
     if (neighbor_cell2->getLevel() >= getLevel() && neighbor_cell21)
@@ -530,36 +633,36 @@ std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getPlane
 
 // Get a pointer to a neighbor cell accessible by 3 consecutive othogonal direction (corners in 3D)
 template<int Nx, int Ny, int Nz, typename DataType>
-std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getVolumeNeighborCell(const unsigned dir, std::array<std::shared_ptr<Cell>, number_plane_neighbors> *cached_neighbors) const {
+Cell<Nx, Ny, Nz, DataType>* Cell<Nx, Ny, Nz, DataType>::getVolumeNeighborCell(const unsigned dir, std::array<Cell*, number_plane_neighbors> *cached_neighbors) const {
   const auto [dir1, dir2, dir3] = ChildAndDirectionTablesType::volumeToDirectDirs(dir);
 
   // If one of the neighbor cells have the same level, then finding the target neighbor cell is easier:
   // - get the direct neighbor cell of same level in direction dir in {dir1, dir2, dir3}
   // - get the target cell by getting its plane neighbor cell in directions {dir1, dir2, dir3} - {dir}
-  std::shared_ptr<Cell> neighbor_cell1 = getNeighborCellAndSave(dir1, cached_neighbors);
+  Cell *neighbor_cell1 = getNeighborCellAndSave(dir1, cached_neighbors);
   if (neighbor_cell1 && neighbor_cell1->getLevel() >= getLevel()) {
-    std::shared_ptr<Cell> neighbor_cell1_23 = neighbor_cell1->getNeighborCell(directToPlaneDir(dir2, dir3));
+    Cell *neighbor_cell1_23 = neighbor_cell1->getNeighborCell(directToPlaneDir(dir2, dir3));
     if (neighbor_cell1_23)
       return neighbor_cell1_23;
   }
-  std::shared_ptr<Cell> neighbor_cell2 = getNeighborCellAndSave(dir2, cached_neighbors);
+  Cell *neighbor_cell2 = getNeighborCellAndSave(dir2, cached_neighbors);
   if (neighbor_cell2 && neighbor_cell2->getLevel() >= getLevel()) {
-    std::shared_ptr<Cell> neighbor_cell2_13 = neighbor_cell2->getNeighborCell(directToPlaneDir(dir1, dir3));
+    Cell *neighbor_cell2_13 = neighbor_cell2->getNeighborCell(directToPlaneDir(dir1, dir3));
     if (neighbor_cell2_13)
       return neighbor_cell2_13;
   }
-  std::shared_ptr<Cell> neighbor_cell3 = getNeighborCellAndSave(dir3, cached_neighbors);
+  Cell *neighbor_cell3 = getNeighborCellAndSave(dir3, cached_neighbors);
   if (neighbor_cell3 && neighbor_cell3->getLevel() >= getLevel()) {
-    std::shared_ptr<Cell> neighbor_cell3_12 = neighbor_cell3->getNeighborCell(directToPlaneDir(dir1, dir2));
+    Cell *neighbor_cell3_12 = neighbor_cell3->getNeighborCell(directToPlaneDir(dir1, dir2));
     if (neighbor_cell3_12)
       return neighbor_cell3_12;
   }
   if (!neighbor_cell1 && !neighbor_cell2 && !neighbor_cell3)
     return nullptr;
 
-  std::shared_ptr<Cell> neighbor_cell12 = getNeighborCellAndSave(directToPlaneDir(dir1, dir2), cached_neighbors),
-                        neighbor_cell13 = getNeighborCellAndSave(directToPlaneDir(dir1, dir3), cached_neighbors),
-                        neighbor_cell23 = getNeighborCellAndSave(directToPlaneDir(dir2, dir3), cached_neighbors);
+  Cell *neighbor_cell12 = getNeighborCellAndSave(directToPlaneDir(dir1, dir2), cached_neighbors),
+       *neighbor_cell13 = getNeighborCellAndSave(directToPlaneDir(dir1, dir3), cached_neighbors),
+       *neighbor_cell23 = getNeighborCellAndSave(directToPlaneDir(dir2, dir3), cached_neighbors);
   if (!neighbor_cell12 && !neighbor_cell13 && !neighbor_cell23)
     return nullptr;
   else if (neighbor_cell12==neighbor_cell13) // If two of the plane neighbors are the same, then they all direct to the target neighbor cell
@@ -569,9 +672,9 @@ std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getVolum
   else if (neighbor_cell13==neighbor_cell23) // If two of the plane neighbors are the same, then they all direct to the target neighbor cell
     return neighbor_cell13;
 
-  std::shared_ptr<Cell> neighbor_cell123 = neighbor_cell12 ? neighbor_cell12->getNeighborCell(dir3) : nullptr,
-                        neighbor_cell132 = neighbor_cell13 ? neighbor_cell13->getNeighborCell(dir2) : nullptr,
-                        neighbor_cell231 = neighbor_cell23 ? neighbor_cell23->getNeighborCell(dir1) : nullptr;
+  Cell *neighbor_cell123 = neighbor_cell12 ? neighbor_cell12->getNeighborCell(dir3) : nullptr,
+       *neighbor_cell132 = neighbor_cell13 ? neighbor_cell13->getNeighborCell(dir2) : nullptr,
+       *neighbor_cell231 = neighbor_cell23 ? neighbor_cell23->getNeighborCell(dir1) : nullptr;
 
   if (!neighbor_cell123 && !neighbor_cell132 && !neighbor_cell231)
     return nullptr;
@@ -585,7 +688,7 @@ std::shared_ptr<Cell<Nx, Ny, Nz, DataType>> Cell<Nx, Ny, Nz, DataType>::getVolum
     return neighbor_cell231;
 
   // Keep the cell with the highest level
-  std::shared_ptr<Cell> neighbor_cell_ijk;
+  Cell *neighbor_cell_ijk = nullptr;
   unsigned level_ij;
   if (!neighbor_cell123) {
     neighbor_cell_ijk = neighbor_cell123;
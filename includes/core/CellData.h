@@ -9,6 +9,7 @@
 #pragma once
 
 #include "AbstractCellData.h"
+#include "CellDataTraits.h"
 
 class CellData : public AbstractCellData {
 	//***********************************************************//
@@ -55,3 +56,11 @@ class CellData : public AbstractCellData {
   // Restore the cell data from an input stream
   void restore(std::istream& is, const bool binary=false) override;
 };
+
+// The value is packed with memcpy in the exchanges and binary snapshots
+template<>
+struct CellDataTraits<CellData> : CellDataTraitsBase {
+  using PayloadType = double;
+  static void pack(const CellData &data, PayloadType &payload) { payload = data.getValue(); }
+  static void unpack(const PayloadType &payload, CellData &data) { data.setValue(payload); }
+};
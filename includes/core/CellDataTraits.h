@@ -0,0 +1,61 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Compile-time properties of the cell data type (specialize for a data type to opt in).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// Default properties (specializations inherit from it and override what they need)
+struct CellDataTraitsBase {
+  // Only leaf cells hold data:
+  // - the parent data is released after the extrapolation function at split
+  // - the parent data is created again before the interpolation function at coarsening
+  // - non-leaf cells handed to the ghost and balance exchanges keep their data
+  static constexpr bool leaf_only = false;
+  // Fixed size trivially copyable payload packed with memcpy in the exchanges and binary snapshots
+  // (void keeps the virtual toVectorOfData/dump path for variable size data). A specialization
+  // setting it also provides:
+  // - static void pack(const DataType &data, PayloadType &payload);
+  // - static void unpack(const PayloadType &payload, DataType &data);
+  using PayloadType = void;
+};
+
+template<typename DataType>
+struct CellDataTraits : CellDataTraitsBase {};
+
+// True if the cell data is packed with memcpy
+template<typename DataType>
+constexpr bool isPackedCellData() {
+  return !std::is_void<typename CellDataTraits<DataType>::PayloadType>::value;
+}
+
+// Number of doubles holding the packed payload of a cell data
+template<typename DataType>
+constexpr std::size_t packedCellDataSize() {
+  using PayloadType = typename CellDataTraits<DataType>::PayloadType;
+  static_assert(std::is_trivially_copyable<PayloadType>::value, "Cell data payload must be trivially copyable");
+  return (sizeof(PayloadType) + sizeof(double) - 1)/sizeof(double);
+}
+
+// Pack the payload of a cell data into a buffer of packedCellDataSize() doubles
+template<typename DataType>
+void packCellData(const DataType &data, double *buffer) {
+  typename CellDataTraits<DataType>::PayloadType payload;
+  CellDataTraits<DataType>::pack(data, payload);
+  std::memcpy(buffer, &payload, sizeof(payload));
+}
+
+// Unpack the payload of a cell data from a buffer of packedCellDataSize() doubles
+template<typename DataType>
+void unpackCellData(const double *buffer, DataType &data) {
+  typename CellDataTraits<DataType>::PayloadType payload;
+  std::memcpy(&payload, buffer, sizeof(payload));
+  CellDataTraits<DataType>::unpack(payload, data);
+}
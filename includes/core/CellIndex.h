@@ -0,0 +1,86 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Hash index from the packed cell key to the cell (open addressing with linear probing) kept up to date
+ *  on split and coarsening through the oct allocator of the tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "OctAllocator.h"
+
+template<typename CellType, typename TreeIteratorType>
+class CellIndex : public OctAllocatorListener<CellType> {
+ public:
+  using CellKeyType = typename TreeIteratorType::CellKeyType;
+  using ExtrapolationFunctionType = std::function<void(const std::shared_ptr<CellType>&)>;
+  using OctType = typename CellType::OctType;
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Tree max level
+  unsigned max_level;
+  // Iterator used for the key computations
+  TreeIteratorType iterator;
+  // Slot keys
+  std::vector<CellKeyType> slot_keys;
+  // Slot cells (nullptr if the slot is empty)
+  std::vector<CellType*> slot_cells;
+  // Number of cells in the index
+  std::size_t number_cells;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor (indexes all the cells under the root cells)
+  CellIndex(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level);
+  // Destructor
+  ~CellIndex() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the number of cells in the index
+  std::size_t size() const { return number_cells; };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Find the cell of a key (nullptr if it does not exist)
+  CellType* find(const CellKeyType cell_key) const;
+  // Find the cell of a key and create it by splitting its deepest existing ancestor if needed
+  CellType* findOrCreate(const CellKeyType cell_key, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Add the child cells of a new oct
+  void octAllocated(const OctType &oct) override;
+  // Remove the child cells (and their descendants) of an oct about to be released
+  void octReleased(const OctType &oct) override;
+ private:
+  // Add a cell and its descendants from the key and the curve orientation of the cell
+  void insertRecurs(CellType *cell, const CellKeyType cell_key, const unsigned orientation);
+  // Remove the child cells of an oct and their descendants from the key and the curve orientation of the parent cell
+  void eraseChildCells(const OctType &oct, const CellKeyType parent_key, const unsigned orientation);
+  // Add a cell
+  void insert(const CellKeyType cell_key, CellType *cell);
+  // Remove a cell (backward shift of the following slots of the probe sequence)
+  void erase(const CellKeyType cell_key);
+  // Double the number of slots and insert back the cells
+  void grow();
+  // Slot of a key in the table
+  std::size_t slotOf(const CellKeyType cell_key) const;
+};
+
+#include "CellIndex.tpp"
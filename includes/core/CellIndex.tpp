@@ -0,0 +1,176 @@
+#include "CellIndex.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor (indexes all the cells under the root cells)
+template<typename CellType, typename TreeIteratorType>
+CellIndex<CellType, TreeIteratorType>::CellIndex(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
+: max_level(max_level),
+  iterator(root_cells, max_level),
+  slot_keys(16),
+  slot_cells(16, nullptr),
+  number_cells(0) {
+  for (unsigned i{0}; i<root_cells.size(); ++i)
+    insertRecurs(root_cells[i].get(), iterator.getCellIdManager().rootKey(i), iterator.getRootOrientation(i));
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Find the cell of a key (nullptr if it does not exist)
+template<typename CellType, typename TreeIteratorType>
+CellType* CellIndex<CellType, TreeIteratorType>::find(const CellKeyType cell_key) const {
+  const std::size_t mask = slot_cells.size() - 1;
+  for (std::size_t slot = slotOf(cell_key); slot_cells[slot]; slot = (slot + 1) & mask)
+    if (slot_keys[slot] == cell_key)
+      return slot_cells[slot];
+  return nullptr;
+}
+
+// Find the cell of a key and create it by splitting its deepest existing ancestor if needed
+template<typename CellType, typename TreeIteratorType>
+CellType* CellIndex<CellType, TreeIteratorType>::findOrCreate(const CellKeyType cell_key, ExtrapolationFunctionType extrapolation_function) {
+  CellType *cell = find(cell_key);
+  if (cell)
+    return cell;
+
+  // Deepest existing ancestor (necessarily a leaf)
+  const auto cell_id_manager = iterator.getCellIdManager();
+  const unsigned level = cell_id_manager.getKeyLevel(cell_key);
+  if (level > max_level)
+    throw std::runtime_error("Cell key deeper than the max level in CellIndex::findOrCreate()");
+  CellKeyType ancestor_key = cell_key;
+  while (!cell && cell_id_manager.getKeyLevel(ancestor_key) > 0) {
+    ancestor_key = cell_id_manager.parentKey(ancestor_key);
+    cell = find(ancestor_key);
+  }
+  if (!cell)
+    throw std::runtime_error("Root cell of key not found in CellIndex::findOrCreate()");
+
+  // Split down to the cell (the new cells are added by the allocator notifications)
+  const std::vector<unsigned> index_path = iterator.orderToIndexPath(cell_id_manager.keyToOrderPath(cell_key));
+  for (unsigned l{cell->getLevel()+1}; l<=level; ++l) {
+    if (cell->isLeaf())
+      cell->split(max_level, extrapolation_function);
+    cell = cell->getChildCell(index_path[l]).get();
+  }
+  return cell;
+}
+
+// Add the child cells of a new oct (their keys follow from the key of the parent cell)
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::octAllocated(const OctType &oct) {
+  unsigned orientation;
+  const CellKeyType parent_key = iterator.getCellKey(oct.getParentCell(), orientation);
+  const auto &cell_id_manager = iterator.getCellIdManager();
+  for (unsigned order{0}; order<CellType::number_children; ++order)
+    insert(cell_id_manager.childKey(parent_key, order), oct.getChildCell(iterator.getChildSiblingNumber(orientation, order)));
+}
+
+// Remove the child cells (and their descendants) of an oct about to be released
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::octReleased(const OctType &oct) {
+  unsigned orientation;
+  const CellKeyType parent_key = iterator.getCellKey(oct.getParentCell(), orientation);
+  eraseChildCells(oct, parent_key, orientation);
+}
+
+// Add a cell and its descendants from the key and the curve orientation of the cell
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::insertRecurs(CellType *cell, const CellKeyType cell_key, const unsigned orientation) {
+  insert(cell_key, cell);
+  if (!cell->isLeaf())
+    for (unsigned order{0}; order<CellType::number_children; ++order)
+      insertRecurs(cell->getChildCell(iterator.getChildSiblingNumber(orientation, order)).get(), iterator.getCellIdManager().childKey(cell_key, order), iterator.getChildOrientation(orientation, order));
+}
+
+// Remove the child cells of an oct and their descendants from the key and the curve orientation of the parent cell
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::eraseChildCells(const OctType &oct, const CellKeyType parent_key, const unsigned orientation) {
+  const auto &cell_id_manager = iterator.getCellIdManager();
+  for (unsigned order{0}; order<CellType::number_children; ++order) {
+    const CellType *child = oct.getChildCell(iterator.getChildSiblingNumber(orientation, order));
+    const CellKeyType child_key = cell_id_manager.childKey(parent_key, order);
+    if (!child->isLeaf())
+      eraseChildCells(*child->getChildOct(), child_key, iterator.getChildOrientation(orientation, order));
+    erase(child_key);
+  }
+}
+
+// Add a cell
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::insert(const CellKeyType cell_key, CellType *cell) {
+  // Keep the load factor under 1/2
+  if (2*(number_cells + 1) > slot_cells.size())
+    grow();
+
+  const std::size_t mask = slot_cells.size() - 1;
+  std::size_t slot = slotOf(cell_key);
+  for (; slot_cells[slot]; slot = (slot + 1) & mask)
+    if (slot_keys[slot] == cell_key) {
+      slot_cells[slot] = cell;
+      return;
+    }
+  slot_keys[slot] = cell_key;
+  slot_cells[slot] = cell;
+  ++number_cells;
+}
+
+// Remove a cell (backward shift of the following slots of the probe sequence)
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::erase(const CellKeyType cell_key) {
+  const std::size_t mask = slot_cells.size() - 1;
+  std::size_t slot = slotOf(cell_key);
+  for (; slot_cells[slot]; slot = (slot + 1) & mask)
+    if (slot_keys[slot] == cell_key)
+      break;
+  if (!slot_cells[slot])
+    return;
+
+  // Move back the following cells that are not at their home slot
+  std::size_t hole = slot;
+  for (std::size_t next = (hole + 1) & mask; slot_cells[next]; next = (next + 1) & mask) {
+    const std::size_t home = slotOf(slot_keys[next]);
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      slot_keys[hole] = slot_keys[next];
+      slot_cells[hole] = slot_cells[next];
+      hole = next;
+    }
+  }
+  slot_cells[hole] = nullptr;
+  --number_cells;
+}
+
+// Double the number of slots and insert back the cells
+template<typename CellType, typename TreeIteratorType>
+void CellIndex<CellType, TreeIteratorType>::grow() {
+  std::vector<CellKeyType> old_keys(2*slot_keys.size());
+  std::vector<CellType*> old_cells(2*slot_cells.size(), nullptr);
+  old_keys.swap(slot_keys);
+  old_cells.swap(slot_cells);
+
+  const std::size_t mask = slot_cells.size() - 1;
+  for (std::size_t i{0}; i<old_cells.size(); ++i)
+    if (old_cells[i]) {
+      std::size_t slot = slotOf(old_keys[i]);
+      while (slot_cells[slot])
+        slot = (slot + 1) & mask;
+      slot_keys[slot] = old_keys[i];
+      slot_cells[slot] = old_cells[i];
+    }
+}
+
+// Slot of a key in the table
+template<typename CellType, typename TreeIteratorType>
+std::size_t CellIndex<CellType, TreeIteratorType>::slotOf(const CellKeyType cell_key) const {
+  // Fold the key on 64 bits and mix it (splitmix64 finalizer)
+  std::uint64_t h = static_cast<std::uint64_t>(cell_key) ^ static_cast<std::uint64_t>((cell_key >> 32) >> 32)*0x9e3779b97f4a7c15ULL;
+  h = (h ^ (h >> 30))*0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27))*0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return static_cast<std::size_t>(h) & (slot_cells.size() - 1);
+}
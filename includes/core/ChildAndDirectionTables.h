@@ -22,13 +22,34 @@
 //  PROTOTYPES.                                              //
 //***********************************************************//
 
-template<int Nx, int Ny, int Nz>
-auto compute_dir_sibling_numbers();
+template<typename ValueType, unsigned CAPACITY>
+struct FixedCapacityList;
+
+template<int Nx, int Ny, int Nz, unsigned NUMBER_OF_DIRECTIONS, unsigned MAX_NUMBER_DIR_CHILDREN>
+constexpr std::array<FixedCapacityList<unsigned, MAX_NUMBER_DIR_CHILDREN>, NUMBER_OF_DIRECTIONS> compute_dir_sibling_numbers();
+
+template<unsigned NUMBER_OF_DIRECTIONS>
+constexpr std::array<int, NUMBER_OF_DIRECTIONS> compute_all_directions();
 
 //***********************************************************//
 //  MAIN CLASS                                               //
 //***********************************************************//
 
+// List stored in place with a fixed capacity (usable in constant expressions), e.g. the sibling numbers or the child
+// cells touching a face, an edge or a corner
+template<typename ValueType, unsigned CAPACITY>
+struct FixedCapacityList {
+  std::array<ValueType, CAPACITY> values{};
+  unsigned count{0};
+
+  constexpr unsigned size() const { return count; };
+  constexpr bool empty() const { return count == 0; };
+  constexpr const ValueType& operator[](const unsigned i) const { return values[i]; };
+  constexpr const ValueType* begin() const { return values.data(); };
+  constexpr const ValueType* end() const { return values.data() + count; };
+  constexpr void push_back(const ValueType &value) { values[count++] = value; };
+};
+
 template<int Nx, int Ny, int Nz>
 struct ChildAndDirectionTables {
  public:
@@ -45,18 +66,20 @@ struct ChildAndDirectionTables {
   static constexpr unsigned N12 = N1 * N2;
   static constexpr unsigned N13 = N1 * N3;
   static constexpr unsigned N23 = N2 * N3;
+  // Largest number of child cells touching a face
+  static constexpr unsigned max_number_dir_children = N12>N13 ? (N12>N23 ? N12 : N23) : (N13>N23 ? N13 : N23);
   static constexpr unsigned max_number_neighbor_leaf_cells_1d = 2;
   static constexpr unsigned max_number_neighbor_leaf_cells_2d = 4 + 2*(N1+N2);
   static constexpr unsigned max_number_neighbor_leaf_cells_3d = 8 + 4*(N1+N2+N3) + 2*(N1*N2+N1*N3+N2*N3);
   static constexpr unsigned max_number_neighbor_leaf_cells = (number_dimensions==1) ? max_number_neighbor_leaf_cells_1d :
                                                              (number_dimensions==2) ? max_number_neighbor_leaf_cells_2d :
                                                              max_number_neighbor_leaf_cells_3d;
-  inline static const std::vector<int> all_directions = (number_dimensions==1) ? std::vector<int>({ 0, 1 }) :
-                                                        (number_dimensions==2) ? std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7 }) :
-                                                        std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25 });
+  using AllDirectionsType = std::array<int, number_of_directions>;
+  static constexpr AllDirectionsType all_directions = compute_all_directions<number_of_directions>();
 
   // Get child cells sibling numbers for each incoming direction
-  inline static const std::array<std::vector<unsigned>, number_of_directions> dir_sibling_numbers = compute_dir_sibling_numbers<Nx, Ny, Nz>();
+  using DirSiblingNumbersType = FixedCapacityList<unsigned, max_number_dir_children>;
+  static constexpr std::array<DirSiblingNumbersType, number_of_directions> dir_sibling_numbers = compute_dir_sibling_numbers<Nx, Ny, Nz, number_of_directions, max_number_dir_children>();
 
   //***********************************************************//
   //  STATIC METHODS                                           //
@@ -83,22 +106,23 @@ struct ChildAndDirectionTables {
 //  IMPLEMEBNTATIONS                                         //
 //***********************************************************//
 
-template<int Nx, int Ny, int Nz>
-auto compute_dir_sibling_numbers() {
-  using ChildAndDirectionTablesType = ChildAndDirectionTables<Nx, Ny, Nz>;
-  static constexpr int N1 = ChildAndDirectionTablesType::N1;
-  static constexpr int N2 = ChildAndDirectionTablesType::N2;
-  static constexpr int N3 = ChildAndDirectionTablesType::N3;
-  static constexpr unsigned number_dimensions = ChildAndDirectionTablesType::number_dimensions;
-  static constexpr unsigned number_neighbors = ChildAndDirectionTablesType::number_neighbors;
-  static constexpr unsigned number_plane_neighbors = ChildAndDirectionTablesType::number_plane_neighbors;
-  static constexpr unsigned number_of_directions = number_dimensions==3 ? 26 : number_dimensions==2 ? 8 : 2;
-
-  std::array<std::vector<unsigned>, number_of_directions> directional_sibling_numbers;
-  for (unsigned dir{0}; dir<number_of_directions; ++dir) {
+template<int Nx, int Ny, int Nz, unsigned NUMBER_OF_DIRECTIONS, unsigned MAX_NUMBER_DIR_CHILDREN>
+constexpr std::array<FixedCapacityList<unsigned, MAX_NUMBER_DIR_CHILDREN>, NUMBER_OF_DIRECTIONS> compute_dir_sibling_numbers() {
+  // Same splitting numbers as ChildAndDirectionTables (the class is not complete yet when this is evaluated)
+  constexpr unsigned number_dimensions = (Nx>0) + (Ny>0) + (Nz>0);
+  constexpr unsigned N1 = Nx>0 ? Nx : Ny>0 ? Ny : Nz;
+  constexpr unsigned N2 = (Nx>0 && Ny>0) ? Ny : number_dimensions>1 ? Nz : 1;
+  constexpr unsigned N3 = number_dimensions==3 ? Nz : 1;
+  constexpr unsigned number_neighbors = 2 * number_dimensions;
+  constexpr unsigned number_plane_neighbors = number_dimensions==3 ? 18 : number_dimensions==2 ? 8 : 2;
+  const auto coords_to_sibling_number = [](const unsigned i, const unsigned j, const unsigned k) { return i + j * N1 + k * N1 * N2; };
+
+  std::array<FixedCapacityList<unsigned, MAX_NUMBER_DIR_CHILDREN>, NUMBER_OF_DIRECTIONS> directional_sibling_numbers{};
+  for (unsigned dir{0}; dir<NUMBER_OF_DIRECTIONS; ++dir) {
+    auto &sibling_numbers = directional_sibling_numbers[dir];
     // Face sibling numbers
     if (dir < number_neighbors) {
-      unsigned ni, Nj, Nk;
+      unsigned ni{0}, Nj{0}, Nk{0};
       switch (dir) {
         case 0: ni = N1-1; Nj = N2; Nk = N3; break;
         case 1: ni = 0;    Nj = N2; Nk = N3; break;
@@ -108,23 +132,19 @@ auto compute_dir_sibling_numbers() {
         case 5: ni = 0;    Nj = N1; Nk = N2; break;
       }
 
-      std::vector<unsigned> face_sibling_numbers;
-      face_sibling_numbers.reserve(Nj * Nk);
       for (unsigned j{0}; j<Nj; ++j)
         for (unsigned k{0}; k<Nk; ++k) {
           if (dir < 2)
-            face_sibling_numbers.push_back(ChildAndDirectionTablesType::coordsToSiblingNumber(ni, j, k));
+            sibling_numbers.push_back(coords_to_sibling_number(ni, j, k));
           else if (dir < 4)
-            face_sibling_numbers.push_back(ChildAndDirectionTablesType::coordsToSiblingNumber(j, ni, k));
+            sibling_numbers.push_back(coords_to_sibling_number(j, ni, k));
           else
-            face_sibling_numbers.push_back(ChildAndDirectionTablesType::coordsToSiblingNumber(j, k, ni));
+            sibling_numbers.push_back(coords_to_sibling_number(j, k, ni));
         }
-
-      directional_sibling_numbers[dir] = face_sibling_numbers;
     }
     // Edge sibling numbers
     else if (dir >= number_neighbors && dir < number_plane_neighbors) {
-      unsigned ni, nj, Nk;
+      unsigned ni{0}, nj{0}, Nk{0};
       switch (dir-number_neighbors) {
         case  0: ni = N1-1; nj = N2-1; Nk = N3; break;
         case  1: ni = 0;    nj = N2-1; Nk = N3; break;
@@ -140,30 +160,26 @@ auto compute_dir_sibling_numbers() {
         case 11: ni = 0;    nj = 0;    Nk = N1; break;
       }
 
-      std::vector<unsigned> edge_sibling_numbers;
-      edge_sibling_numbers.reserve(Nk);
       for (unsigned k{0}; k<Nk; ++k) {
         if (dir-number_neighbors < 4)
-          edge_sibling_numbers.push_back(ChildAndDirectionTablesType::coordsToSiblingNumber(ni, nj,  k));
+          sibling_numbers.push_back(coords_to_sibling_number(ni, nj,  k));
         else if (dir-number_neighbors < 8)
-          edge_sibling_numbers.push_back(ChildAndDirectionTablesType::coordsToSiblingNumber(ni,  k, nj));
+          sibling_numbers.push_back(coords_to_sibling_number(ni,  k, nj));
         else
-          edge_sibling_numbers.push_back(ChildAndDirectionTablesType::coordsToSiblingNumber( k, ni, nj));
+          sibling_numbers.push_back(coords_to_sibling_number( k, ni, nj));
       }
-
-      directional_sibling_numbers[dir] = edge_sibling_numbers;
     }
     // Corner sibling numbers
     else if (dir >= number_plane_neighbors) {
       switch (dir) {
-        case 18: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(Nx-1, Ny-1, Nz-1) }; break;
-        case 19: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(0   , Ny-1, Nz-1) }; break;
-        case 20: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(Nx-1, 0   , Nz-1) }; break;
-        case 21: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(0   , 0   , Nz-1) }; break;
-        case 22: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(Nx-1, Ny-1, 0   ) }; break;
-        case 23: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(0   , Ny-1, 0   ) }; break;
-        case 24: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(Nx-1, 0   , 0   ) }; break;
-        case 25: directional_sibling_numbers[dir] = { ChildAndDirectionTablesType::coordsToSiblingNumber(0   , 0   , 0   ) }; break;
+        case 18: sibling_numbers.push_back(coords_to_sibling_number(N1-1, N2-1, N3-1)); break;
+        case 19: sibling_numbers.push_back(coords_to_sibling_number(0   , N2-1, N3-1)); break;
+        case 20: sibling_numbers.push_back(coords_to_sibling_number(N1-1, 0   , N3-1)); break;
+        case 21: sibling_numbers.push_back(coords_to_sibling_number(0   , 0   , N3-1)); break;
+        case 22: sibling_numbers.push_back(coords_to_sibling_number(N1-1, N2-1, 0   )); break;
+        case 23: sibling_numbers.push_back(coords_to_sibling_number(0   , N2-1, 0   )); break;
+        case 24: sibling_numbers.push_back(coords_to_sibling_number(N1-1, 0   , 0   )); break;
+        case 25: sibling_numbers.push_back(coords_to_sibling_number(0   , 0   , 0   )); break;
       }
     }
   }
@@ -171,4 +187,12 @@ auto compute_dir_sibling_numbers() {
   return directional_sibling_numbers;
 }
 
+template<unsigned NUMBER_OF_DIRECTIONS>
+constexpr std::array<int, NUMBER_OF_DIRECTIONS> compute_all_directions() {
+  std::array<int, NUMBER_OF_DIRECTIONS> all_directions{};
+  for (unsigned dir{0}; dir<NUMBER_OF_DIRECTIONS; ++dir)
+    all_directions[dir] = dir;
+  return all_directions;
+}
+
 #include "ChildAndDirectionTables.tpp"
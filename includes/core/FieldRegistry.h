@@ -0,0 +1,98 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Registry of named fields stored as contiguous arrays (structure of arrays) indexed by the owned leaf position along the SFC.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Non-owning view on a contiguous array of values
+template<typename T>
+class FieldSpan {
+ private:
+  T *ptr;
+  std::size_t count;
+
+ public:
+  FieldSpan(T *ptr = nullptr, const std::size_t count = 0) : ptr(ptr), count(count) {}
+  T* data() const { return ptr; };
+  std::size_t size() const { return count; };
+  bool empty() const { return count == 0; };
+  T& operator[](const std::size_t i) const { return ptr[i]; };
+  T* begin() const { return ptr; };
+  T* end() const { return ptr + count; };
+};
+
+class FieldRegistry {
+ public:
+  // Named field (component c of the leaf i is stored at values[c*number_leaves + i])
+  struct Field {
+    std::string name;
+    unsigned number_components;
+    std::vector<double> values;
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Registered fields
+  std::vector<Field> fields;
+  // Number of owned leaves (length of each field component)
+  std::size_t number_leaves;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor
+  FieldRegistry();
+  // Destructor
+  ~FieldRegistry() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // True if no field is registered
+  bool empty() const { return fields.empty(); };
+  // Get the number of owned leaves
+  std::size_t getNumberLeaves() const { return number_leaves; };
+  // Get the registered fields
+  const std::vector<Field>& getFields() const { return fields; };
+  // True if a field is registered
+  bool hasField(const std::string &name) const;
+  // Get the number of components of a field
+  unsigned getNumberComponents(const std::string &name) const;
+  // Get a component of a field
+  FieldSpan<double> getField(const std::string &name, const unsigned component = 0);
+  FieldSpan<const double> getField(const std::string &name, const unsigned component = 0) const;
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Register a field (values are initialized to zero)
+  void addField(const std::string &name, const unsigned number_components, const std::size_t number_leaves);
+  // Remove a field
+  void removeField(const std::string &name);
+  // Remap the fields after a refinement or a coarsening given the levels and ownership of all the leaves along the SFC before and after
+  // - new leaves inside an old leaf get its value
+  // - a new leaf covering old leaves gets their volume weighted average
+  void remap(const std::vector<unsigned char> &old_levels, const std::vector<bool> &old_owned, const std::vector<unsigned char> &new_levels, const std::vector<bool> &new_owned, const unsigned number_children);
+  // Redistribute the fields after a load balancing (the owned leaves keep their global SFC order)
+  void redistribute(const std::size_t new_number_leaves, const unsigned rank, const unsigned size);
+  // Redistribute the fields given the number of owned leaves of each process before and after (no communication of the
+  // counts)
+  void redistribute(const std::vector<unsigned> &old_counts, const std::vector<unsigned> &new_counts, const unsigned rank);
+ private:
+  // Find a field by name (throws if not found)
+  Field& findField(const std::string &name);
+  const Field& findField(const std::string &name) const;
+};
@@ -0,0 +1,75 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Lists of the cells of each level along the space-filling curve. The levels touched by a split or a
+ *  coarsening are flagged through the oct allocator of the tree and rebuilt from the level above on the next access.
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "OctAllocator.h"
+
+template<typename CellType, typename TreeIteratorType>
+class LevelIndex : public OctAllocatorListener<CellType> {
+ public:
+  using OctType = typename CellType::OctType;
+  static constexpr unsigned number_children = CellType::number_children;
+  static constexpr unsigned number_of_orientations = TreeIteratorType::number_of_orientations;
+  // Cell of a level with its curve orientation
+  struct LevelEntry {
+    const std::shared_ptr<CellType> *cell;
+    unsigned char orientation;
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Tree max level
+  unsigned max_level;
+  // Sibling number and curve orientation of the child of an order for each mother orientation
+  std::array<std::array<unsigned char, number_children>, number_of_orientations> child_sibling_numbers, child_orientations;
+  // Cells of each level along the SFC
+  std::vector<std::vector<LevelEntry>> levels;
+  // Levels to rebuild before their next access
+  std::vector<bool> dirty_levels;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor (the root cells must outlive the index)
+  LevelIndex(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level);
+  // Destructor
+  ~LevelIndex() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the cells of a level along the SFC (rebuilds the flagged levels down to it)
+  const std::vector<LevelEntry>& getLevel(const unsigned level);
+  // Check if a level must be rebuilt before its next access
+  bool isDirty(const unsigned level) const { return dirty_levels[level]; };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Flag the level of the child cells of a new oct
+  void octAllocated(const OctType &oct) override;
+  // Flag the level of the child cells of an oct about to be released (and the deeper levels if they have descendants)
+  void octReleased(const OctType &oct) override;
+ private:
+  // Rebuild a level from the level above
+  void rebuildLevel(const unsigned level);
+};
+
+#include "LevelIndex.tpp"
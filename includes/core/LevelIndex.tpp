@@ -0,0 +1,82 @@
+#include "LevelIndex.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor (the root cells must outlive the index)
+template<typename CellType, typename TreeIteratorType>
+LevelIndex<CellType, TreeIteratorType>::LevelIndex(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
+: max_level(max_level),
+  levels(max_level+1),
+  dirty_levels(max_level+1, true) {
+  // Curve tables of the tree iterator
+  const TreeIteratorType curve(root_cells, max_level);
+  for (unsigned orientation{0}; orientation<number_of_orientations; ++orientation)
+    for (unsigned order{0}; order<number_children; ++order) {
+      child_sibling_numbers[orientation][order] = curve.getChildSiblingNumber(orientation, order);
+      child_orientations[orientation][order] = curve.getChildOrientation(orientation, order);
+    }
+
+  // Root cells in the SFC order
+  for (unsigned i{0}; i<root_cells.size(); ++i)
+    levels[0].push_back(LevelEntry{&root_cells[i], static_cast<unsigned char>(curve.getRootOrientation(i))});
+  dirty_levels[0] = false;
+}
+
+
+//***********************************************************//
+//  ACCESSORS                                                //
+//***********************************************************//
+
+// Get the cells of a level along the SFC (rebuilds the flagged levels down to it)
+template<typename CellType, typename TreeIteratorType>
+const std::vector<typename LevelIndex<CellType, TreeIteratorType>::LevelEntry>& LevelIndex<CellType, TreeIteratorType>::getLevel(const unsigned level) {
+  if (level > max_level)
+    throw std::runtime_error("Level deeper than the max level in LevelIndex::getLevel()");
+
+  // A level is rebuilt from the level above so the flagged levels are rebuilt top down
+  for (unsigned l{1}; l<=level; ++l)
+    if (dirty_levels[l])
+      rebuildLevel(l);
+  return levels[level];
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Flag the level of the child cells of a new oct
+template<typename CellType, typename TreeIteratorType>
+void LevelIndex<CellType, TreeIteratorType>::octAllocated(const OctType &oct) {
+  dirty_levels[oct.getLevel()] = true;
+}
+
+// Flag the level of the child cells of an oct about to be released (and the deeper levels if they have descendants)
+template<typename CellType, typename TreeIteratorType>
+void LevelIndex<CellType, TreeIteratorType>::octReleased(const OctType &oct) {
+  dirty_levels[oct.getLevel()] = true;
+  for (const auto &child : oct.getChildCells())
+    if (!child->isLeaf()) {
+      for (unsigned l{oct.getLevel()+1}; l<=max_level; ++l)
+        dirty_levels[l] = true;
+      return;
+    }
+}
+
+// Rebuild a level from the level above
+template<typename CellType, typename TreeIteratorType>
+void LevelIndex<CellType, TreeIteratorType>::rebuildLevel(const unsigned level) {
+  std::vector<LevelEntry> &cells = levels[level];
+  cells.clear();
+  for (const LevelEntry &entry : levels[level-1]) {
+    const CellType &cell = **entry.cell;
+    if (cell.isLeaf())
+      continue;
+    const auto &child_cells = cell.getChildOct()->getChildCells();
+    for (unsigned order{0}; order<number_children; ++order)
+      cells.push_back(LevelEntry{&child_cells[child_sibling_numbers[entry.orientation][order]], child_orientations[entry.orientation][order]});
+  }
+  dirty_levels[level] = false;
+}
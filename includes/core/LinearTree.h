@@ -0,0 +1,113 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Linear octree (sorted array of leaf SFC keys with parallel arrays of levels, ownership and data)
+ *  for read-mostly phases between adaptations.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+template<typename TreeType>
+class LinearTree {
+ public:
+  using CellType = typename TreeType::CellType;
+  using CellDataType = typename CellType::CellDataType;
+  using TreeIteratorType = typename TreeType::TreeIteratorType;
+  // Leaf key: root index in the high bits then one SFC order digit per level (left aligned on the max level)
+  using KeyType = std::uint64_t;
+  using CoordsType = std::array<KeyType, 3>;
+  static constexpr unsigned number_children = CellType::number_children;
+  static constexpr unsigned number_neighbors = CellType::number_neighbors;
+  static constexpr std::array<unsigned, 3> number_splits = { CellType::ChildAndDirectionTablesType::N1, CellType::ChildAndDirectionTablesType::N2, CellType::ChildAndDirectionTablesType::N3 };
+  // Number of bits of an order digit
+  static constexpr unsigned bits_per_level = [] {
+    unsigned bits{0};
+    while ((1u << bits) < number_children)
+      ++bits;
+    return bits;
+  }();
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Tree max level
+  unsigned max_level;
+  // Iterator used for the index path <-> order path conversions and the curve tables
+  TreeIteratorType iterator;
+  // Neighbor root index in each direction (-1 if none)
+  std::vector<std::array<int, number_neighbors>> root_neighbors;
+  // Number of finest cells along each axis of a root cell for each level span
+  std::array<std::vector<KeyType>, 3> powers;
+  // Leaf keys in SFC order
+  std::vector<KeyType> keys;
+  // Leaf levels
+  std::vector<unsigned char> levels;
+  // Leaf ownership
+  std::vector<bool> owned;
+  // Leaf data
+  std::vector<CellDataType> data;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor (all the leaves of the tree along its SFC)
+  LinearTree(const TreeType &tree);
+  // Destructor
+  ~LinearTree() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the number of leaves
+  std::size_t size() const { return keys.size(); };
+  // Get the leaf keys
+  const std::vector<KeyType>& getKeys() const { return keys; };
+  // Get the key of a leaf
+  KeyType getKey(const std::size_t i) const { return keys[i]; };
+  // Get the level of a leaf
+  unsigned getLevel(const std::size_t i) const { return levels[i]; };
+  // True if a leaf belongs to this process
+  bool belongToThisProc(const std::size_t i) const { return owned[i]; };
+  // Get the data of a leaf
+  CellDataType& getCellData(const std::size_t i) { return data[i]; };
+  const CellDataType& getCellData(const std::size_t i) const { return data[i]; };
+  // Get the index path of a leaf
+  std::vector<unsigned> getIndexPath(const std::size_t i) const { return keyToIndexPath(keys[i], levels[i]); };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Find the leaf containing the cell of a key and level (returns size() if none)
+  std::size_t find(const KeyType key, const unsigned level) const;
+  // Get the leaves sharing a face with a leaf in a direction (one same level or coarser leaf, or the finer leaves touching the face)
+  void getNeighborLeaves(const std::size_t i, const unsigned dir, std::vector<std::size_t> &neighbors) const;
+  // Create the leaves in a tree with the same root cells (not finer than the linear tree) and copy back the data and ownership
+  void toTree(TreeType &tree) const;
+  // Convert an order path to a key
+  KeyType orderPathToKey(const std::vector<unsigned> &order_path) const;
+  // Convert a key to the index path of the cell of a level
+  std::vector<unsigned> keyToIndexPath(const KeyType key, const unsigned level) const;
+ private:
+  // Add the position of a cell inside its ancestor of a coarser level to the position of the ancestor (in number of finest
+  // cells along each axis) by decoding the key digits below the ancestor level (orientation goes from the ancestor to the cell)
+  void addDescendantCoords(const KeyType key, const unsigned ancestor_level, const unsigned level, unsigned &orientation, CoordsType &coords) const;
+  // Get the key and the curve orientation of the cell of a level at a position in a root cell
+  KeyType coordsToKey(const unsigned root_index, const CoordsType &coords, const unsigned level, unsigned &orientation) const;
+  // Set a parent to belong to this proc if any of its child do else set to other proc
+  bool backPropagateOwnershipFlags(const std::shared_ptr<CellType> &cell) const;
+};
+
+#include "LinearTree.tpp"
@@ -0,0 +1,217 @@
+#include "LinearTree.h"
+
+#include <algorithm>
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor (all the leaves of the tree along its SFC)
+template<typename TreeType>
+LinearTree<TreeType>::LinearTree(const TreeType &tree)
+: max_level(tree.getMaxLevel()),
+  iterator(tree.getRootCells(), tree.getMaxLevel()) {
+  const auto &root_cells = tree.getRootCells();
+  unsigned root_bits{0};
+  while ((std::size_t(1) << root_bits) < root_cells.size())
+    ++root_bits;
+  if (root_bits + max_level*bits_per_level > 63)
+    throw std::runtime_error("Too many root cells or levels for 64-bit keys in LinearTree::LinearTree()");
+
+  // Root connectivity (the neighbors are stored in the root child oct)
+  root_neighbors.resize(root_cells.size());
+  for (const auto &root_cell : root_cells)
+    for (unsigned dir{0}; dir<number_neighbors; ++dir) {
+      const CellType *neighbor_cell = root_cell->isLeaf() ? nullptr : root_cell->getChildOct()->getNeighborCell(dir);
+      root_neighbors[root_cell->getRootIndex()][dir] = neighbor_cell ? static_cast<int>(neighbor_cell->getRootIndex()) : -1;
+    }
+
+  for (unsigned a{0}; a<3; ++a) {
+    powers[a].resize(max_level+1);
+    powers[a][0] = 1;
+    for (unsigned l{1}; l<=max_level; ++l)
+      powers[a][l] = powers[a][l-1]*number_splits[a];
+  }
+
+  // Leaves along the SFC (keys are increasing)
+  iterator.toBegin();
+  do {
+    const CellType *cell = iterator.getCellPtr();
+    keys.push_back(orderPathToKey(iterator.getOrderPath()));
+    levels.push_back(cell->getLevel());
+    owned.push_back(cell->belongToThisProc());
+    data.push_back(cell->hasCellData() ? cell->getCellData() : CellDataType());
+  } while (iterator.next());
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Find the leaf containing the cell of a key and level (returns size() if none)
+template<typename TreeType>
+std::size_t LinearTree<TreeType>::find(const KeyType key, const unsigned level) const {
+  const auto it = std::upper_bound(keys.begin(), keys.end(), key);
+  if (it == keys.begin())
+    return keys.size();
+  const std::size_t i = std::distance(keys.begin(), it) - 1;
+  if (levels[i] > level)
+    return keys.size();
+  const unsigned shift = (max_level - levels[i])*bits_per_level;
+  return (keys[i] >> shift) == (key >> shift) ? i : keys.size();
+}
+
+// Get the leaves sharing a face with a leaf in a direction (one same level or coarser leaf, or the finer leaves touching the face)
+template<typename TreeType>
+void LinearTree<TreeType>::getNeighborLeaves(const std::size_t i, const unsigned dir, std::vector<std::size_t> &neighbors) const {
+  if (dir>=number_neighbors)
+    throw std::runtime_error("Invalid neighbor direction in LinearTree::getNeighborLeaves()");
+  neighbors.clear();
+
+  // Same level neighbor cell (crossing to the neighbor root at the root boundary)
+  const unsigned level = levels[i], axis = dir/2;
+  int root_index = keys[i] >> max_level*bits_per_level;
+  unsigned orientation = iterator.getRootOrientation(root_index);
+  CoordsType coords{0, 0, 0};
+  addDescendantCoords(keys[i], 0, level, orientation, coords);
+  const KeyType extent = powers[axis][max_level-level], root_extent = powers[axis][max_level];
+  if (dir%2 == 0) {
+    if (coords[axis] == 0) {
+      root_index = root_neighbors[root_index][dir];
+      coords[axis] = root_extent;
+    }
+    coords[axis] -= extent;
+  } else {
+    coords[axis] += extent;
+    if (coords[axis] == root_extent) {
+      root_index = root_neighbors[root_index][dir];
+      coords[axis] = 0;
+    }
+  }
+  if (root_index < 0)
+    return;
+  const KeyType key = coordsToKey(root_index, coords, level, orientation);
+
+  // Same level or coarser leaf
+  const std::size_t j = find(key, level);
+  if (j < keys.size()) {
+    neighbors.push_back(j);
+    return;
+  }
+
+  // Finer leaves inside the neighbor cell touching the face (only their digits below the neighbor cell level are decoded)
+  const KeyType key_end = key + (KeyType(1) << (max_level - level)*bits_per_level);
+  const auto first = std::lower_bound(keys.begin(), keys.end(), key),
+             last = std::lower_bound(first, keys.end(), key_end);
+  for (auto it = first; it!=last; ++it) {
+    const std::size_t k = std::distance(keys.begin(), it);
+    CoordsType leaf_coords = coords;
+    unsigned leaf_orientation = orientation;
+    addDescendantCoords(keys[k], level, levels[k], leaf_orientation, leaf_coords);
+    const bool touching = dir%2 == 0 ? leaf_coords[axis] + powers[axis][max_level-levels[k]] == coords[axis] + extent
+                                     : leaf_coords[axis] == coords[axis];
+    if (touching)
+      neighbors.push_back(k);
+  }
+}
+
+// Create the leaves in a tree with the same root cells (not finer than the linear tree) and copy back the data and ownership
+template<typename TreeType>
+void LinearTree<TreeType>::toTree(TreeType &tree) const {
+  if (tree.getRootCells().size() != root_neighbors.size() || tree.getMaxLevel() != max_level)
+    throw std::runtime_error("Tree root cells or max level differ from the linear tree in LinearTree::toTree()");
+
+  TreeIteratorType tree_iterator(tree.getRootCells(), tree.getMaxLevel());
+  const auto cell_id_manager = tree_iterator.getCellIdManager();
+  std::vector<typename TreeIteratorType::CellKeyType> cell_keys(keys.size());
+  for (std::size_t i{0}; i<keys.size(); ++i)
+    cell_keys[i] = cell_id_manager.orderPathToKey(tree_iterator.indexToOrderPath(getIndexPath(i)));
+
+  // Consecutive leaves share most of their ancestors so the iterator only climbs to the common one
+  tree_iterator.toCellKeys(cell_keys, true, [this](const std::shared_ptr<CellType> &cell_ptr, const unsigned i) {
+    CellType *cell = cell_ptr.get();
+    if (!cell->isLeaf())
+      throw std::runtime_error("Tree is finer than the linear tree in LinearTree::toTree()");
+    cell->allocateCellData();
+    cell->getCellData() = data[i];
+    if (owned[i])
+      cell->setToThisProc();
+    else
+      cell->setToOtherProc();
+  });
+
+  for (const auto &root_cell : tree.getRootCells())
+    backPropagateOwnershipFlags(root_cell);
+  tree.updateOwnedRoots();
+}
+
+// Convert an order path to a key
+template<typename TreeType>
+typename LinearTree<TreeType>::KeyType LinearTree<TreeType>::orderPathToKey(const std::vector<unsigned> &order_path) const {
+  KeyType key = KeyType(order_path[0]) << max_level*bits_per_level;
+  for (std::size_t l{1}; l<order_path.size(); ++l)
+    key |= KeyType(order_path[l]) << (max_level - l)*bits_per_level;
+  return key;
+}
+
+// Convert a key to the index path of the cell of a level
+template<typename TreeType>
+std::vector<unsigned> LinearTree<TreeType>::keyToIndexPath(const KeyType key, const unsigned level) const {
+  constexpr KeyType mask = (KeyType(1) << bits_per_level) - 1;
+  std::vector<unsigned> order_path(level+1);
+  order_path[0] = key >> max_level*bits_per_level;
+  for (unsigned l{1}; l<=level; ++l)
+    order_path[l] = (key >> (max_level - l)*bits_per_level) & mask;
+  return iterator.orderToIndexPath(order_path);
+}
+
+// Add the position of a cell inside its ancestor of a coarser level to the position of the ancestor (in number of finest
+// cells along each axis) by decoding the key digits below the ancestor level (orientation goes from the ancestor to the cell)
+template<typename TreeType>
+void LinearTree<TreeType>::addDescendantCoords(const KeyType key, const unsigned ancestor_level, const unsigned level, unsigned &orientation, CoordsType &coords) const {
+  constexpr KeyType mask = (KeyType(1) << bits_per_level) - 1;
+  for (unsigned l{ancestor_level+1}; l<=level; ++l) {
+    const unsigned order = (key >> (max_level - l)*bits_per_level) & mask;
+    const auto [i, j, k] = CellType::siblingNumberToCoords(iterator.getChildSiblingNumber(orientation, order));
+    coords[0] += i*powers[0][max_level-l];
+    coords[1] += j*powers[1][max_level-l];
+    coords[2] += k*powers[2][max_level-l];
+    orientation = iterator.getChildOrientation(orientation, order);
+  }
+}
+
+// Get the key and the curve orientation of the cell of a level at a position in a root cell
+template<typename TreeType>
+typename LinearTree<TreeType>::KeyType LinearTree<TreeType>::coordsToKey(const unsigned root_index, const CoordsType &coords, const unsigned level, unsigned &orientation) const {
+  KeyType key = KeyType(root_index) << max_level*bits_per_level;
+  orientation = iterator.getRootOrientation(root_index);
+  for (unsigned l{1}; l<=level; ++l) {
+    const unsigned sibling_number = CellType::coordsToSiblingNumber((coords[0]/powers[0][max_level-l]) % number_splits[0],
+                                                                    (coords[1]/powers[1][max_level-l]) % number_splits[1],
+                                                                    (coords[2]/powers[2][max_level-l]) % number_splits[2]);
+    const unsigned order = iterator.getChildOrder(orientation, sibling_number);
+    key |= KeyType(order) << (max_level - l)*bits_per_level;
+    orientation = iterator.getChildOrientation(orientation, order);
+  }
+  return key;
+}
+
+// Set a parent to belong to this proc if any of its child do else set to other proc
+template<typename TreeType>
+bool LinearTree<TreeType>::backPropagateOwnershipFlags(const std::shared_ptr<CellType> &cell) const {
+  if (cell->isLeaf())
+    return cell->belongToThisProc();
+
+  bool to_this_proc = false;
+  for (const auto &child : cell->getChildCells())
+    if (backPropagateOwnershipFlags(child))
+      to_this_proc = true;
+
+  if (to_this_proc)
+    cell->setToThisProc();
+  else
+    cell->setToOtherProc();
+
+  return to_this_proc;
+}
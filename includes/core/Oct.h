@@ -25,13 +25,13 @@ class Oct {
 	//  VARIABLES                                                //
 	//***********************************************************//
  private:
-  // Oct parent
-  std::shared_ptr<CellType> parent_cell;
+  // Oct parent (non-owning)
+  CellType *parent_cell;
   // Oct level
   unsigned level;
-  // Neighbor cells
-  std::array<std::shared_ptr<CellType>, number_neighbors> neighbor_cells;
-  // Child cells
+  // Neighbor cells (non-owning)
+  std::array<CellType*, number_neighbors> neighbor_cells;
+  // Child cells (handles sharing the ownership of the oct block)
   std::array<std::shared_ptr<CellType>, number_children> child_cells;
 
 	//***********************************************************//
@@ -43,7 +43,7 @@ class Oct {
   // Destructor
   ~Oct();
   // Oct initializer
-  void init(std::shared_ptr<CellType> parent_cell, unsigned level);
+  void init(CellType *parent_cell, unsigned level);
   // Clear oct
   void clear();
   // Reset oct
@@ -54,24 +54,24 @@ class Oct {
 	//***********************************************************//
  public:
   // Get parent cell
-  std::shared_ptr<CellType> getParentCell() const;
+  CellType* getParentCell() const;
   // Get level of the oct
   unsigned getLevel() const;
   // Get neighbor cells
-  const std::array<std::shared_ptr<CellType>, number_neighbors>& getNeighborCells() const;
+  const std::array<CellType*, number_neighbors>& getNeighborCells() const;
   // Get child cells
   const std::array<std::shared_ptr<CellType>, number_children>& getChildCells() const;
   // Get a specific child cell
-  std::shared_ptr<CellType> getChildCell(const unsigned sibling_number) const;
+  CellType* getChildCell(const unsigned sibling_number) const;
 
   //***********************************************************//
 	//  MUTATORS                                                 //
 	//***********************************************************//
  public:
   // Set the parent cell
-  void setParentCell(std::shared_ptr<CellType> cell);
+  void setParentCell(CellType *cell);
   // Set the neighbor cell (only for direct neighbors)
-  void setNeighborCell(const unsigned dir, std::shared_ptr<CellType> cell);
+  void setNeighborCell(const unsigned dir, CellType *cell);
   // Set a specific child cell
   void setChildCell(const unsigned sibling_number, std::shared_ptr<CellType> cell);
 
@@ -82,7 +82,7 @@ class Oct {
   // Get the sibling number (position of the cell in the child_cells array)
   unsigned getSiblingNumber(const CellType* ptr_child_cell) const;
   // Get a pointer to a neighbor cell
-  std::shared_ptr<CellType> getNeighborCell(const unsigned dir) const;
+  CellType* getNeighborCell(const unsigned dir) const;
 };
 
 #include "Oct.tpp"
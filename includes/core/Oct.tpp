@@ -6,7 +6,11 @@
 
 // Constructor
 template<typename CellType>
-Oct<CellType>::Oct() {}
+Oct<CellType>::Oct()
+: parent_cell(nullptr),
+  level(0) {
+  neighbor_cells.fill(nullptr);
+}
 
 // Destructor
 template<typename CellType>
@@ -14,7 +18,7 @@ Oct<CellType>::~Oct() {}
 
 // Oct initializer
 template<typename CellType>
-void Oct<CellType>::init(std::shared_ptr<CellType> parent_cell, unsigned level) {
+void Oct<CellType>::init(CellType *parent_cell, unsigned level) {
   this->parent_cell = parent_cell;
   this->level = level;
   neighbor_cells.fill(nullptr);
@@ -33,7 +37,7 @@ void Oct<CellType>::clear() {
 // Reset oct
 template<typename CellType>
 void Oct<CellType>::reset() {
-  parent_cell.reset();
+  parent_cell = nullptr;
   level = 0;
   neighbor_cells.fill(nullptr);
   child_cells.fill(nullptr);
@@ -46,7 +50,7 @@ void Oct<CellType>::reset() {
 
 // Get parent cell
 template<typename CellType>
-std::shared_ptr<CellType> Oct<CellType>::getParentCell() const { return parent_cell; };
+CellType* Oct<CellType>::getParentCell() const { return parent_cell; };
 
 // Get level of the oct
 template<typename CellType>
@@ -54,7 +58,7 @@ unsigned Oct<CellType>::getLevel() const { return level; };
 
 // Get neighbor cells
 template<typename CellType>
-const std::array<std::shared_ptr<CellType>, Oct<CellType>::number_neighbors>& Oct<CellType>::getNeighborCells() const { return neighbor_cells; };
+const std::array<CellType*, Oct<CellType>::number_neighbors>& Oct<CellType>::getNeighborCells() const { return neighbor_cells; };
 
 // Get child cells
 template<typename CellType>
@@ -62,10 +66,10 @@ const std::array<std::shared_ptr<CellType>, Oct<CellType>::number_children>& Oct
 
 // Get a specific child cell
 template<typename CellType>
-std::shared_ptr<CellType> Oct<CellType>::getChildCell(const unsigned sibling_number) const {
+CellType* Oct<CellType>::getChildCell(const unsigned sibling_number) const {
   if (sibling_number>=number_children)
     throw std::runtime_error("Invalid siblign number in Oct::getChildCell()");
-  return child_cells[sibling_number];
+  return child_cells[sibling_number].get();
 };
 
 
@@ -75,13 +79,13 @@ std::shared_ptr<CellType> Oct<CellType>::getChildCell(const unsigned sibling_num
 
 // Set the parent cell
 template<typename CellType>
-void Oct<CellType>::setParentCell(std::shared_ptr<CellType> cell) {
+void Oct<CellType>::setParentCell(CellType *cell) {
   parent_cell = cell;
 }
 
 // Set the neighbor cell (only for direct neighbors)
 template<typename CellType>
-void Oct<CellType>::setNeighborCell(const unsigned dir, std::shared_ptr<CellType> cell) {
+void Oct<CellType>::setNeighborCell(const unsigned dir, CellType *cell) {
   if (dir>=number_neighbors)
     throw std::runtime_error("Cannot set neighbor in Oct::setNeighborCell()");
   neighbor_cells[dir] = cell;
@@ -103,6 +107,9 @@ void Oct<CellType>::setChildCell(const unsigned sibling_number, std::shared_ptr<
 // Get the sibling number (position of the cell in the child_cells array)
 template<typename CellType>
 unsigned Oct<CellType>::getSiblingNumber(const CellType* ptr_child_cell) const {
+  // Fast path using the sibling number stored in the cell header
+  if (ptr_child_cell && ptr_child_cell->getParentOct()==this && child_cells[ptr_child_cell->getSiblingNumber()].get()==ptr_child_cell)
+    return ptr_child_cell->getSiblingNumber();
   for (size_t i{0}; i<child_cells.size(); ++i)
     if (child_cells[i].get() == ptr_child_cell)
       return i;
@@ -111,7 +118,7 @@ unsigned Oct<CellType>::getSiblingNumber(const CellType* ptr_child_cell) const {
 
 // Get a pointer to a neighbor cell
 template<typename CellType>
-std::shared_ptr<CellType> Oct<CellType>::getNeighborCell(const unsigned dir) const {
+CellType* Oct<CellType>::getNeighborCell(const unsigned dir) const {
   if (dir>=number_neighbors)
     throw std::runtime_error("Invalid direct neighbor direction in Oct::getNeighborCell()");
 
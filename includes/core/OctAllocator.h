@@ -0,0 +1,153 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Slab allocator creating an oct, its child cells and their data in one memory block.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Observer of the octs created and released through an allocator
+template<typename CellType>
+class OctAllocatorListener {
+ public:
+  using OctType = typename CellType::OctType;
+  virtual ~OctAllocatorListener() = default;
+  // Called once the child cells of a new oct are constructed
+  virtual void octAllocated(const OctType &oct) = 0;
+  // Called before the child cells of an oct are released
+  virtual void octReleased(const OctType &oct) = 0;
+};
+
+template<typename CellType>
+class OctAllocator : public std::enable_shared_from_this<OctAllocator<CellType>> {
+ public:
+  using OctType = typename CellType::OctType;
+  using CellDataType = typename CellType::CellDataType;
+  using ListenerType = OctAllocatorListener<CellType>;
+  static constexpr unsigned number_children = CellType::number_children;
+  // Data is stored in the block unless only leaf cells hold data (it is then created on the heap)
+  static constexpr bool data_in_block = !CellType::leaf_only_data;
+
+  // Memory block holding an oct, its child cells and their data
+  struct OctBlock {
+    OctType oct;
+    alignas(CellType) unsigned char cells_storage[number_children*sizeof(CellType)];
+    alignas(CellDataType) unsigned char data_storage[data_in_block ? number_children*sizeof(CellDataType) : 1];
+    unsigned number_constructed_cells = 0;
+
+    ~OctBlock() {
+      for (unsigned i{0}; i<number_constructed_cells; ++i)
+        cell(i)->~CellType();
+    }
+    CellType* cell(const unsigned i) { return std::launder(reinterpret_cast<CellType*>(cells_storage) + i); }
+    void* data(const unsigned i) { return data_storage + i*sizeof(CellDataType); }
+  };
+
+  // Standard allocator serving the oct blocks (and their shared_ptr control block) from the slabs
+  template<typename T>
+  class BlockAllocator {
+   public:
+    using value_type = T;
+    std::shared_ptr<OctAllocator> oct_allocator;
+
+    BlockAllocator(std::shared_ptr<OctAllocator> oct_allocator) : oct_allocator(std::move(oct_allocator)) {}
+    template<typename U>
+    BlockAllocator(const BlockAllocator<U> &other) : oct_allocator(other.oct_allocator) {}
+
+    T* allocate(const std::size_t n) {
+      if (n!=1 || alignof(T)>alignof(std::max_align_t))
+        return std::allocator<T>().allocate(n);
+      return static_cast<T*>(oct_allocator->allocateChunk(sizeof(T)));
+    }
+    void deallocate(T *ptr, const std::size_t n) {
+      if (n!=1 || alignof(T)>alignof(std::max_align_t))
+        return std::allocator<T>().deallocate(ptr, n);
+      oct_allocator->deallocateChunk(ptr, sizeof(T));
+    }
+    template<typename U>
+    bool operator==(const BlockAllocator<U> &other) const { return oct_allocator == other.oct_allocator; }
+    template<typename U>
+    bool operator!=(const BlockAllocator<U> &other) const { return oct_allocator != other.oct_allocator; }
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Number of chunks allocated at once
+  const std::size_t number_chunks_per_slab;
+  // Size of a chunk (fixed by the first allocation)
+  std::size_t chunk_size;
+  // Slabs of contiguous chunks
+  std::vector<std::unique_ptr<unsigned char[]>> slabs;
+  // Chunks released by coarsening and available for reuse
+  std::vector<void*> free_chunks;
+  // Number of chunks currently in use
+  std::size_t number_used_chunks;
+  // Number of chunks to make available when the chunk size is known (reservation before the first allocation)
+  std::size_t number_reserved_chunks;
+  // Notified of the octs created and released (not owned)
+  std::vector<ListenerType*> listeners;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor
+  OctAllocator(const std::size_t number_chunks_per_slab = 256);
+  // Destructor
+  ~OctAllocator();
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the number of slabs allocated
+  std::size_t getNumberSlabs() const { return slabs.size(); };
+  // Get the number of blocks in use
+  std::size_t getNumberUsedBlocks() const { return number_used_chunks; };
+  // Get the number of blocks available for reuse
+  std::size_t getNumberFreeBlocks() const { return free_chunks.size(); };
+
+  //***********************************************************//
+  //  MUTATORS                                                 //
+  //***********************************************************//
+ public:
+  // Add a listener notified of the octs created and released
+  void addListener(ListenerType *listener) { listeners.push_back(listener); };
+  // Remove a listener (nothing is done if it is not registered)
+  void removeListener(const ListenerType *listener) { listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end()); };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Create an oct and its child cells in a single block taken from the slabs
+  std::shared_ptr<OctType> allocateOct(CellType *parent_cell, const unsigned level, const int indicator);
+  // Create an oct and its child cells in a single heap block (without allocator)
+  static std::shared_ptr<OctType> makeOct(CellType *parent_cell, const unsigned level, const int indicator);
+  // Notify the listeners that the child cells of an oct are about to be released
+  void releaseOct(const OctType &oct) { for (ListenerType *listener : listeners) listener->octReleased(oct); };
+  // Get a chunk from the free list or from the last slab
+  void* allocateChunk(const std::size_t size);
+  // Give back a chunk to the free list
+  void deallocateChunk(void *ptr, const std::size_t size);
+  // Make a number of blocks available for allocation in a single slab (before a bulk split)
+  void reserveBlocks(const std::size_t number_blocks);
+ private:
+  // Create a slab and make all its chunks available
+  void addSlab(const std::size_t number_chunks);
+  // Construct the oct and the child cells of a block (the returned oct and the child cell handles share the ownership of
+  // the block, the cycle through the oct is broken when the oct is cleared)
+  static std::shared_ptr<OctType> initBlock(const std::shared_ptr<OctBlock> &block, CellType *parent_cell, const unsigned level, const int indicator, OctAllocator *oct_allocator);
+};
+
+#include "OctAllocator.tpp"
@@ -0,0 +1,115 @@
+#include "OctAllocator.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor
+template<typename CellType>
+OctAllocator<CellType>::OctAllocator(const std::size_t number_chunks_per_slab)
+: number_chunks_per_slab(std::max<std::size_t>(number_chunks_per_slab, 1)),
+  chunk_size(0),
+  number_used_chunks(0),
+  number_reserved_chunks(0) {}
+
+// Destructor
+template<typename CellType>
+OctAllocator<CellType>::~OctAllocator() {
+  free_chunks.clear();
+  slabs.clear();
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Create an oct and its child cells in a single block taken from the slabs
+template<typename CellType>
+std::shared_ptr<typename OctAllocator<CellType>::OctType> OctAllocator<CellType>::allocateOct(CellType *parent_cell, const unsigned level, const int indicator) {
+  std::shared_ptr<OctType> oct = initBlock(std::allocate_shared<OctBlock>(BlockAllocator<OctBlock>(this->shared_from_this())), parent_cell, level, indicator, this);
+  for (ListenerType *listener : listeners)
+    listener->octAllocated(*oct);
+  return oct;
+}
+
+// Create an oct and its child cells in a single heap block (without allocator)
+template<typename CellType>
+std::shared_ptr<typename OctAllocator<CellType>::OctType> OctAllocator<CellType>::makeOct(CellType *parent_cell, const unsigned level, const int indicator) {
+  return initBlock(std::make_shared<OctBlock>(), parent_cell, level, indicator, nullptr);
+}
+
+// Get a chunk from the free list or from the last slab
+template<typename CellType>
+void* OctAllocator<CellType>::allocateChunk(const std::size_t size) {
+  if (chunk_size==0) {
+    chunk_size = size;
+    if (number_reserved_chunks > 0)
+      addSlab(number_reserved_chunks);
+    number_reserved_chunks = 0;
+  }
+  if (size!=chunk_size)
+    return ::operator new(size);
+
+  // Create a new slab if no chunk is available
+  if (free_chunks.empty())
+    addSlab(number_chunks_per_slab);
+
+  void *ptr = free_chunks.back();
+  free_chunks.pop_back();
+  ++number_used_chunks;
+  return ptr;
+}
+
+// Give back a chunk to the free list
+template<typename CellType>
+void OctAllocator<CellType>::deallocateChunk(void *ptr, const std::size_t size) {
+  if (size!=chunk_size) {
+    ::operator delete(ptr);
+    return;
+  }
+  free_chunks.push_back(ptr);
+  --number_used_chunks;
+}
+
+// Make a number of blocks available for allocation in a single slab (before a bulk split)
+template<typename CellType>
+void OctAllocator<CellType>::reserveBlocks(const std::size_t number_blocks) {
+  // The chunk size is only known at the first allocation
+  if (chunk_size==0) {
+    number_reserved_chunks = std::max(number_reserved_chunks, number_blocks);
+    return;
+  }
+  if (free_chunks.size() < number_blocks)
+    addSlab(number_blocks - free_chunks.size());
+}
+
+// Create a slab and make all its chunks available
+template<typename CellType>
+void OctAllocator<CellType>::addSlab(const std::size_t number_chunks) {
+  constexpr std::size_t alignment = alignof(std::max_align_t);
+  const std::size_t stride = (chunk_size + alignment - 1)/alignment*alignment;
+  // The chunks are constructed on allocation (no zero filling of the slab)
+  slabs.push_back(std::unique_ptr<unsigned char[]>(new unsigned char[stride*number_chunks]));
+  free_chunks.reserve(free_chunks.size() + number_chunks);
+  for (std::size_t i{number_chunks}; i-->0; )
+    free_chunks.push_back(slabs.back().get() + i*stride);
+}
+
+// Construct the oct and the child cells of a block (the returned oct and the child cell handles share the ownership of
+// the block, the cycle through the oct is broken when the oct is cleared)
+template<typename CellType>
+std::shared_ptr<typename OctAllocator<CellType>::OctType> OctAllocator<CellType>::initBlock(const std::shared_ptr<OctBlock> &block, CellType *parent_cell, const unsigned level, const int indicator, OctAllocator *oct_allocator) {
+  std::shared_ptr<OctType> oct(block, &block->oct);
+  oct->init(parent_cell, level);
+
+  for (unsigned i{0}; i<number_children; ++i) {
+    typename CellType::CellDataPtrType data = data_in_block ? typename CellType::CellDataPtrType(new (block->data(i)) CellDataType(), typename CellType::CellDataDeleter{true})
+                                                            : typename CellType::CellDataPtrType(new CellDataType(), typename CellType::CellDataDeleter{false});
+    CellType *cell = new (block->cell(i)) CellType(oct.get(), indicator, std::move(data), i);
+    ++block->number_constructed_cells;
+    cell->setOctAllocator(oct_allocator);
+    oct->setChildCell(i, std::shared_ptr<CellType>(block, cell));
+  }
+  return oct;
+}
@@ -10,6 +10,8 @@
 
 #include <array>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 template<typename CellType>
 struct RootCellEntry {
@@ -26,6 +28,9 @@ struct RootCellEntry {
   // Constructor
   RootCellEntry(std::shared_ptr<CellType> cell);
   ~RootCellEntry();
+  // Create the root cells of a brick with the number of roots along each axis and their connectivity (periodic axes
+  // wrap around), the roots are numbered with the first axis varying fastest
+  static std::vector<RootCellEntry> createBrick(const std::array<unsigned, CellType::number_dimensions> &number_roots, const std::array<bool, CellType::number_dimensions> &periodic = {});
 
 	//***********************************************************//
 	//  ACCESSORS                                                //
@@ -18,6 +18,46 @@ RootCellEntry<CellType>::~RootCellEntry() {
   neighbor_cells.fill(nullptr);
 }
 
+// Create the root cells of a brick with the number of roots along each axis and their connectivity (periodic axes
+// wrap around), the roots are numbered with the first axis varying fastest
+template<typename CellType>
+std::vector<RootCellEntry<CellType>> RootCellEntry<CellType>::createBrick(const std::array<unsigned, CellType::number_dimensions> &number_roots, const std::array<bool, CellType::number_dimensions> &periodic) {
+  constexpr unsigned number_dimensions = CellType::number_dimensions;
+
+  // Index stride along each axis
+  std::array<size_t, number_dimensions> strides;
+  size_t number_root_cells{1};
+  for (unsigned d{0}; d<number_dimensions; ++d) {
+    if (number_roots[d] == 0)
+      throw std::runtime_error("Empty brick in RootCellEntry::createBrick()");
+    strides[d] = number_root_cells;
+    number_root_cells *= number_roots[d];
+  }
+
+  // Create the root cells
+  std::vector<RootCellEntry> entries;
+  entries.reserve(number_root_cells);
+  for (size_t i{0}; i<number_root_cells; ++i)
+    entries.emplace_back(std::make_shared<CellType>(nullptr));
+
+  // Connect each root cell to its neighbors along every axis (directions -x, +x, -y, +y, -z, +z)
+  for (size_t i{0}; i<number_root_cells; ++i)
+    for (unsigned d{0}; d<number_dimensions; ++d) {
+      const size_t coord = (i / strides[d]) % number_roots[d];
+      const size_t wrap = (number_roots[d]-1) * strides[d];
+      if (coord > 0)
+        entries[i].neighbor_cells[2*d] = entries[i-strides[d]].cell;
+      else if (periodic[d])
+        entries[i].neighbor_cells[2*d] = entries[i+wrap].cell;
+      if (coord+1 < number_roots[d])
+        entries[i].neighbor_cells[2*d+1] = entries[i+strides[d]].cell;
+      else if (periodic[d])
+        entries[i].neighbor_cells[2*d+1] = entries[i-wrap].cell;
+    }
+
+  return entries;
+}
+
 
 //***********************************************************//
 //  ACCESSORS                                                //
@@ -8,34 +8,54 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <utility>
 #include <vector>
 
+#include "AdaptationLog.h"
 #include "Cell.h"
+#include "CellIndex.h"
+#include "FieldRegistry.h"
+#include "LevelIndex.h"
+#include "iterator/LeafBatch.h"
 #include "iterator/MortonIterator.h"
+#include "iterator/OwnedLeafRange.h"
+#include "iterator/SfcLeafIterator.h"
 #include "manager/BalanceManager.h"
 #include "manager/CoarseManager.h"
 #include "manager/GhostManager.h"
+#include "manager/MarkManager.h"
 #include "manager/MinLevelMeshManager.h"
 #include "manager/RefineManager.h"
 #include "RootCellEntry.h"
+#include "../parallel/WorkStealingPool.h"
+#include "../parallel/allgather.h"
 
 template<typename CellTypeT, typename TreeIteratorTypeT = MortonIterator<CellTypeT>>
 class Tree {
  public:
   using CellType = CellTypeT;
+  using AdaptationLogType = AdaptationLog<CellType, TreeIteratorTypeT>;
   using BalanceManagerType = BalanceManager<CellType, TreeIteratorTypeT>;
+  using CellIndexType = CellIndex<CellType, TreeIteratorTypeT>;
   using CoarseManagerType = CoarseManager<CellType>;
   using ExtrapolationFunctionType = std::function<void(const std::shared_ptr<CellType>&)>;
   using InterpolationFunctionType = std::function<void(const std::shared_ptr<CellType>&)>;
   using GhostManagerType = GhostManager<CellType, TreeIteratorTypeT>;
   using GhostManagerTaskType = typename GhostManager<CellType, TreeIteratorTypeT>::GhostManagerTaskType;
+  using LevelIndexType = LevelIndex<CellType, TreeIteratorTypeT>;
+  using MarkManagerType = MarkManager<CellType>;
   using MinLevelMeshManagerType = MinLevelMeshManager<CellType, TreeIteratorTypeT>;
+  using OctAllocatorType = typename CellType::OctAllocatorType;
+  using OwnedLeafRangeType = OwnedLeafRange<CellType, TreeIteratorTypeT>;
   using RefineManagerType = RefineManager<CellType>;
   using RootCellEntryType = RootCellEntry<CellType>;
+  using SfcLeafIteratorType = SfcLeafIterator<CellType, TreeIteratorTypeT>;
   using TreeIteratorType = TreeIteratorTypeT;
+  using CellKeyType = typename TreeIteratorType::CellKeyType;
 
   //***********************************************************//
   //  DATA                                                     //
@@ -51,12 +71,26 @@ class Tree {
   const unsigned size;
   // Root cells
   std::vector<std::shared_ptr<CellType>> root_cells;
+  // Range of the root cells belonging to this process (updated when the partition changes)
+  std::pair<unsigned, unsigned> owned_roots;
+  // Allocator of the octs created under the root cells
+  std::shared_ptr<OctAllocatorType> oct_allocator;
+  // Index from the cell key to the cell (updated by the oct allocator on split and coarsening)
+  std::unique_ptr<CellIndexType> cell_index;
+  // Cells of each level along the SFC (levels touched by split and coarsening are rebuilt on access)
+  std::unique_ptr<LevelIndexType> level_index;
+  // Changes made by the last adaptation call (recorded only when enabled)
+  std::unique_ptr<AdaptationLogType> adaptation_log;
+  // Fields stored per owned leaf (remapped by refine, coarsen and loadBalance)
+  FieldRegistry field_registry;
   // Load balancing manager
 	BalanceManagerType balanceManager;
   // Mesh coarsening manager
 	CoarseManagerType coarseManager;
   // Ghost cell manager
 	GhostManagerType ghostManager;
+  // Refinement and coarsening marking manager
+	MarkManagerType markManager;
   // Min level meshing manager
 	MinLevelMeshManagerType minLevelMeshManager;
   // Mesh refinement manager
@@ -68,10 +102,14 @@ class Tree {
  public:
   // Constructor
   Tree(const unsigned min_level = 1, const unsigned max_level = 2, const unsigned rank = 0, const unsigned size = 1);
+  // Move constructor (the cell and level indices and the oct allocator are kept)
+  Tree(Tree &&tree) = default;
   // Destructor
   ~Tree();
   // Create root cell
   void createRootCells(const std::vector<RootCellEntryType> &root_cell_entries);
+  // Create a brick of root cells (see RootCellEntry::createBrick)
+  void createBrickRootCells(const std::array<unsigned, CellType::number_dimensions> &number_roots, const std::array<bool, CellType::number_dimensions> &periodic = {});
 
   //***********************************************************//
   //  ACCESSORS                                                //
@@ -79,12 +117,29 @@ class Tree {
  public:
   // Get root cells
   const std::vector<std::shared_ptr<CellType>>& getRootCells() const;
+  // Get the range [first, last) of the root cells belonging to this process
+  const std::pair<unsigned, unsigned>& getOwnedRoots() const { return owned_roots; };
   // Get min mesh level
   unsigned getMinLevel() const;
   // Get max mesh level
   unsigned getMaxLevel() const;
   // Get ghost manager
   GhostManagerType getGhostManager() const;
+  // Get the oct allocator
+  const OctAllocatorType& getOctAllocator() const;
+  // Get the index from the cell key to the cell
+  CellIndexType& getCellIndex();
+  const CellIndexType& getCellIndex() const;
+  // Get the changes made by the last adaptation call (refine, refineBulk, coarsen, balanceLevels or loadBalance)
+  const AdaptationLogType& getAdaptationLog() const;
+  // Check if the adaptation calls record their changes
+  bool isAdaptationLogEnabled() const { return static_cast<bool>(adaptation_log); };
+  // Get the field registry
+  FieldRegistry& getFieldRegistry() { return field_registry; };
+  const FieldRegistry& getFieldRegistry() const { return field_registry; };
+  // Get a component of a field (indexed by the owned leaf position of applyToOwnedLeaves)
+  FieldSpan<double> getField(const std::string &name, const unsigned component = 0) { return field_registry.getField(name, component); };
+  FieldSpan<const double> getField(const std::string &name, const unsigned component = 0) const { return field_registry.getField(name, component); };
   // Default directions
   static const std::vector<int>& defaultDirections() {
     static const std::vector<int> dirs = [] {
@@ -99,12 +154,37 @@ class Tree {
   //  METHODS                                                  //
   //***********************************************************//
  public:
-  // Recusively mesh the tree to ensure every cell is at least at min level
+  // Record the changes made by each adaptation call (to enable on all the processes since loadBalance then exchanges
+  // the partition sizes)
+  void enableAdaptationLog(const bool enable = true);
+
+  // Register a field stored per owned leaf (values are initialized to zero)
+  void addField(const std::string &name, const unsigned number_components = 1);
+
+  // Recusively mesh the tree to ensure every cell is at least at min level (the fields are remapped, which needs a single
+  // process since the parallel meshing partitions the tree again)
   void meshAtMinLevel();
   void meshAtMinLevel(TreeIteratorType &iterator);
 
+  // Flag the owned leaves for refinement and coarsening from their errors (collective, see MarkStrategy): from an array
+  // indexed by the owned leaf position, from a field component, or from any callable taking the cell and returning its
+  // error (called concurrently with a thread pool)
+  MarkCounts markErrors(FieldSpan<const double> errors, const MarkParameters &parameters);
+  MarkCounts markField(const std::string &name, const MarkParameters &parameters, const unsigned component = 0);
+  template<typename Function>
+  MarkCounts markLeaves(Function &&error_function, const MarkParameters &parameters);
+  template<typename Function>
+  MarkCounts markLeaves(Function &&error_function, const MarkParameters &parameters, WorkStealingPool &pool);
+
   // Split all the leaf cells belonging to this proc that need to be refined and are not at max level
   bool refine(ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Split all the flagged leaf cells at once with a separate 2:1 balance pass (returns the number of flagged cells and
+  // of cells split for balance)
+  RefineCounts refineBulk(ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+
+  // Split the owned leaf cells so that the mesh is 2:1 balanced across the partition boundaries (collective, to call
+  // after refine or coarsen and before building the ghost layer, returns the number of exchange rounds)
+  unsigned balanceLevels(ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
 
   // Creation of ghost cells
   GhostManagerTaskType buildGhostLayer(InterpolationFunctionType interpolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }, const std::vector<int> &directions = defaultDirections());
@@ -119,10 +199,16 @@ class Tree {
 
   //--- Coarsening --------------------------------------------//
   bool coarsen(InterpolationFunctionType interpolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Coarsen with the verification and the interpolation running on a thread pool (the interpolation function is called
+  // concurrently on independent families)
+  bool coarsen(InterpolationFunctionType interpolation_function, WorkStealingPool &pool);
 
   //--- Computing SFC indices ---------------------------------//
   void boundaryConditions() {};
 
+  // Update the range of the root cells belonging to this process (after changing the ownership flags outside the tree)
+  void updateOwnedRoots();
+
   // Count the number of owned leaf cells
   unsigned countOwnedLeaves() const;
 
@@ -132,25 +218,57 @@ class Tree {
   // Count the number of ghost leaf cells
   unsigned countGhostLeaves() const;
 
-  // Apply a function to owned leaf cells
-  void applyToOwnedLeaves(const std::function<void(const std::shared_ptr<CellType>&, const unsigned)> &f) const;
+  // Apply a function to owned leaf cells (any callable taking the cell and its owned leaf position)
+  template<typename Function>
+  void applyToOwnedLeaves(Function &&f) const;
+  // Apply a function to batches of N consecutive owned leaf cells (any callable taking a LeafBatch)
+  template<unsigned N, typename Function>
+  void applyToOwnedLeafBatches(Function &&f) const;
+  // Apply a function to owned leaf cells on a thread pool (any callable taking the cell, its owned leaf position and
+  // the thread index, called concurrently): the owned SFC range is split in subtrees at the chunk level
+  template<typename Function>
+  void applyToOwnedLeavesParallel(Function &&f, WorkStealingPool &pool) const;
+  template<typename Function>
+  void applyToOwnedLeavesParallel(Function &&f, WorkStealingPool &pool, const unsigned chunk_level) const;
+  // Range of the owned leaf cells along the SFC
+  OwnedLeafRangeType ownedLeaves() const { return OwnedLeafRangeType(root_cells, max_level, owned_roots); };
+
+  // Apply a function to the owned (or ghost) cells of a level along the SFC (any callable taking the cell and its
+  // position among the visited cells)
+  template<typename Function>
+  void applyToLevel(const unsigned level, Function &&f, const bool ghost = false) const;
 
-  // Apply a function to all cells
-  void applyToAllCells(const std::function<void(const std::shared_ptr<CellType>&, const unsigned)> &f) const;
+  // Apply a function to all cells (any callable taking the cell and its position)
+  template<typename Function>
+  void applyToAllCells(Function &&f) const;
 
   // Share the partitions start and end cells
  public:
-  void sharePartitions(std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids) const;
+  void sharePartitions(std::vector<CellKeyType> &begin_keys, std::vector<CellKeyType> &end_keys) const;
  private:
-  void sharePartitions(std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids, TreeIteratorType &iterator) const;
+  void sharePartitions(std::vector<CellKeyType> &begin_keys, std::vector<CellKeyType> &end_keys, TreeIteratorType &iterator) const;
 
   // Apply a function to ghost leaf cells
  public:
-  void applyToGhostLeavesRanks(const std::function<void(const std::shared_ptr<CellType>&, const unsigned, const unsigned)> &f) const;
+  template<typename Function>
+  void applyToGhostLeavesRanks(Function &&f) const;
  private:
-  void applyToGhostLeavesRanks(const std::function<void(const std::shared_ptr<CellType>&, const unsigned, const unsigned)> &f, TreeIteratorType &iterator) const;
-  void applyToGhostLeaves(const std::function<void(const std::shared_ptr<CellType>&, const unsigned, const unsigned)> &f, std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids, unsigned &index, TreeIteratorType &iterator) const;
-  void applyToAllCellsRecurs(const std::shared_ptr<CellType> &cell, const std::function<void(const std::shared_ptr<CellType>&, const unsigned)> &f, unsigned &index) const;
+  template<typename Function>
+  void applyToGhostLeavesRanks(Function &f, TreeIteratorType &iterator) const;
+  template<typename Function>
+  void applyToGhostLeaves(Function &f, const std::vector<CellKeyType> &begin_keys, const std::vector<CellKeyType> &end_keys, unsigned &index, TreeIteratorType &iterator) const;
+  template<typename Function>
+  void applyToAllCellsRecurs(const std::shared_ptr<CellType> &cell, Function &f, unsigned &index) const;
+  // Start recording the changes of an adaptation call (if the log is enabled)
+  void beginAdaptationLog();
+  // Stop recording the changes and sort them along the SFC
+  void endAdaptationLog();
+  // Get the owned leaf cells along the SFC
+  void collectOwnedLeaves(std::vector<CellType*> &cells) const;
+  // Get the levels and ownership of all the leaves along the SFC (for remapping the fields)
+  void collectLeafLevels(std::vector<unsigned char> &levels, std::vector<bool> &owned) const;
+  // Remap the fields after a structure change given the leaves before the change
+  void remapFields(const std::vector<unsigned char> &old_levels, const std::vector<bool> &old_owned);
 };
 
 #include "Tree.tpp"
@@ -12,27 +12,42 @@ Tree<CellType, TreeIteratorType>::Tree(const unsigned min_level, const unsigned
   max_level(max_level),
   rank(rank),
   size(size),
+  owned_roots(0, 0),
+  oct_allocator(std::make_shared<OctAllocatorType>()),
   balanceManager(min_level, max_level, rank, size),
   coarseManager(min_level, max_level, rank, size),
   ghostManager(min_level, max_level, rank, size),
+  markManager(min_level, max_level, rank, size),
   minLevelMeshManager(min_level, max_level, rank, size),
   refineManager(min_level, max_level, rank, size) {}
 
 // Destructor
 template<typename CellType, typename TreeIteratorType>
 Tree<CellType, TreeIteratorType>::~Tree() {
+  if (oct_allocator) {
+    oct_allocator->removeListener(cell_index.get());
+    oct_allocator->removeListener(level_index.get());
+    oct_allocator->removeListener(adaptation_log.get());
+  }
   for (auto &root_cell : root_cells)
-    if (root_cell)
+    if (root_cell) {
+      root_cell->setOctAllocator(nullptr);
       root_cell.reset();
+    }
   root_cells.clear();
 }
 
 // Create root cell
 template<typename CellType, typename TreeIteratorType>
 void Tree<CellType, TreeIteratorType>::createRootCells(const std::vector<RootCellEntryType> &root_cell_entries) {
+  oct_allocator->removeListener(cell_index.get());
+  oct_allocator->removeListener(level_index.get());
+  oct_allocator->removeListener(adaptation_log.get());
   root_cells.clear();
   for (const auto &entry : root_cell_entries) {
     auto cell = entry.cell;
+    cell->setOctAllocator(oct_allocator.get());
+    cell->setRootIndex(root_cells.size());
     root_cells.push_back(cell);
 
     // Split root cells for setting child oct neighbors
@@ -43,9 +58,26 @@ void Tree<CellType, TreeIteratorType>::createRootCells(const std::vector<RootCel
     for (unsigned dir{0}; dir<CellType::number_neighbors; ++dir) {
       const auto &neighbor = entry.neighbor_cells[dir];
       if (neighbor)
-        cell->getChildOct()->setNeighborCell(dir, neighbor);
+        cell->getChildOct()->setNeighborCell(dir, neighbor.get());
     }
   }
+
+  // Index the cells and keep the indices up to date on split and coarsening
+  cell_index = std::make_unique<CellIndexType>(root_cells, max_level);
+  oct_allocator->addListener(cell_index.get());
+  level_index = std::make_unique<LevelIndexType>(root_cells, max_level);
+  oct_allocator->addListener(level_index.get());
+  // The log only listens during the adaptation calls
+  if (adaptation_log)
+    adaptation_log = std::make_unique<AdaptationLogType>(root_cells, max_level);
+
+  updateOwnedRoots();
+}
+
+// Create a brick of root cells (see RootCellEntry::createBrick)
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::createBrickRootCells(const std::array<unsigned, CellType::number_dimensions> &number_roots, const std::array<bool, CellType::number_dimensions> &periodic) {
+  createRootCells(RootCellEntryType::createBrick(number_roots, periodic));
 }
 
 
@@ -77,11 +109,54 @@ typename Tree<CellType, TreeIteratorType>::GhostManagerType Tree<CellType, TreeI
   return ghostManager;
 }
 
+// Get the oct allocator
+template<typename CellType, typename TreeIteratorType>
+const typename Tree<CellType, TreeIteratorType>::OctAllocatorType& Tree<CellType, TreeIteratorType>::getOctAllocator() const {
+  return *oct_allocator;
+}
+
+// Get the index from the cell key to the cell
+template<typename CellType, typename TreeIteratorType>
+typename Tree<CellType, TreeIteratorType>::CellIndexType& Tree<CellType, TreeIteratorType>::getCellIndex() {
+  if (!cell_index)
+    throw std::runtime_error("Root cells not created in Tree::getCellIndex()");
+  return *cell_index;
+}
+template<typename CellType, typename TreeIteratorType>
+const typename Tree<CellType, TreeIteratorType>::CellIndexType& Tree<CellType, TreeIteratorType>::getCellIndex() const {
+  if (!cell_index)
+    throw std::runtime_error("Root cells not created in Tree::getCellIndex()");
+  return *cell_index;
+}
+
+// Get the changes made by the last adaptation call (refine, refineBulk, coarsen, balanceLevels or loadBalance)
+template<typename CellType, typename TreeIteratorType>
+const typename Tree<CellType, TreeIteratorType>::AdaptationLogType& Tree<CellType, TreeIteratorType>::getAdaptationLog() const {
+  if (!adaptation_log)
+    throw std::runtime_error("Adaptation log not enabled in Tree::getAdaptationLog()");
+  return *adaptation_log;
+}
+
 
 //***********************************************************//
 //  METHODS                                                  //
 //***********************************************************//
 
+// Record the changes made by each adaptation call
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::enableAdaptationLog(const bool enable) {
+  if (!enable)
+    adaptation_log.reset();
+  else if (!adaptation_log)
+    adaptation_log = std::make_unique<AdaptationLogType>(root_cells, max_level);
+}
+
+// Register a field stored per owned leaf (values are initialized to zero)
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::addField(const std::string &name, const unsigned number_components) {
+  field_registry.addField(name, number_components, countOwnedLeaves());
+}
+
 // Recusively mesh the tree to ensure every cell is at least at
 // min level
 template<typename CellType, typename TreeIteratorType>
@@ -91,23 +166,144 @@ void Tree<CellType, TreeIteratorType>::meshAtMinLevel() {
 }
 template<typename CellType, typename TreeIteratorType>
 void Tree<CellType, TreeIteratorType>::meshAtMinLevel(TreeIteratorType &iterator) {
+  // The parallel meshing partitions the tree again without moving the field values
+  if (size > 1 && !field_registry.empty())
+    throw std::runtime_error("Fields cannot be kept by a parallel meshing at min level in Tree::meshAtMinLevel()");
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  unsigned old_number_owned_leaves{0};
+  if (!field_registry.empty()) {
+    collectLeafLevels(old_levels, old_owned);
+    old_number_owned_leaves = countOwnedLeaves();
+  }
+
   // Meshing at minimum level
 	minLevelMeshManager.meshAtMinLevel(root_cells, iterator);
+  updateOwnedRoots();
+  if (!field_registry.empty() && countOwnedLeaves() != old_number_owned_leaves)
+    remapFields(old_levels, old_owned);
+}
+
+// Flag the owned leaves for refinement and coarsening from an array of errors indexed by the owned leaf position
+template<typename CellType, typename TreeIteratorType>
+MarkCounts Tree<CellType, TreeIteratorType>::markErrors(FieldSpan<const double> errors, const MarkParameters &parameters) {
+  std::vector<CellType*> cells;
+  collectOwnedLeaves(cells);
+  return markManager.mark(cells, errors, parameters);
+}
+
+// Flag the owned leaves for refinement and coarsening from a field component
+template<typename CellType, typename TreeIteratorType>
+MarkCounts Tree<CellType, TreeIteratorType>::markField(const std::string &name, const MarkParameters &parameters, const unsigned component) {
+  return markErrors(std::as_const(field_registry).getField(name, component), parameters);
+}
+
+// Flag the owned leaves for refinement and coarsening from a callable taking the cell and returning its error
+template<typename CellType, typename TreeIteratorType>
+template<typename Function>
+MarkCounts Tree<CellType, TreeIteratorType>::markLeaves(Function &&error_function, const MarkParameters &parameters) {
+  std::vector<CellType*> cells;
+  std::vector<double> errors;
+  applyToOwnedLeaves([&cells, &errors, &error_function](const std::shared_ptr<CellType> &cell, const unsigned index) {
+    (void)index;
+    cells.push_back(cell.get());
+    errors.push_back(error_function(cell));
+  });
+  return markManager.mark(cells, FieldSpan<const double>(errors.data(), errors.size()), parameters);
+}
+
+// Flag the owned leaves for refinement and coarsening from a callable taking the cell and returning its error (the
+// errors, the histograms and the flagging are computed on a thread pool)
+template<typename CellType, typename TreeIteratorType>
+template<typename Function>
+MarkCounts Tree<CellType, TreeIteratorType>::markLeaves(Function &&error_function, const MarkParameters &parameters, WorkStealingPool &pool) {
+  const unsigned number_leaves = countOwnedLeaves();
+  std::vector<CellType*> cells(number_leaves);
+  std::vector<double> errors(number_leaves);
+  applyToOwnedLeavesParallel([&cells, &errors, &error_function](const std::shared_ptr<CellType> &cell, const unsigned index, const unsigned thread) {
+    (void)thread;
+    cells[index] = cell.get();
+    errors[index] = error_function(cell);
+  }, pool);
+  return markManager.mark(cells, FieldSpan<const double>(errors.data(), errors.size()), parameters, &pool);
 }
 
 // Split all the leaf cells belonging to this proc that need to
 // be refined  and are not at max level
 template<typename CellType, typename TreeIteratorType>
 bool Tree<CellType, TreeIteratorType>::refine(ExtrapolationFunctionType extrapolation_function) {
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  if (!field_registry.empty())
+    collectLeafLevels(old_levels, old_owned);
+
 	// Refining mesh
-	return refineManager.refine(root_cells, extrapolation_function);
+  beginAdaptationLog();
+  const bool structure_changed = refineManager.refine(root_cells, extrapolation_function);
+  endAdaptationLog();
+  if (structure_changed && !field_registry.empty())
+    remapFields(old_levels, old_owned);
+  return structure_changed;
+}
+
+// Split all the flagged leaf cells at once with a separate 2:1 balance pass (returns the number of flagged cells and
+// of cells split for balance)
+template<typename CellType, typename TreeIteratorType>
+RefineCounts Tree<CellType, TreeIteratorType>::refineBulk(ExtrapolationFunctionType extrapolation_function) {
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  if (!field_registry.empty())
+    collectLeafLevels(old_levels, old_owned);
+
+	// Refining mesh
+  beginAdaptationLog();
+  const RefineCounts counts = refineManager.refineBulk(root_cells, extrapolation_function);
+  endAdaptationLog();
+  if (counts.number_flagged + counts.number_balance > 0 && !field_registry.empty())
+    remapFields(old_levels, old_owned);
+  return counts;
+}
+
+// Split the owned leaf cells so that the mesh is 2:1 balanced across the partition boundaries
+template<typename CellType, typename TreeIteratorType>
+unsigned Tree<CellType, TreeIteratorType>::balanceLevels(ExtrapolationFunctionType extrapolation_function) {
+  TreeIteratorType iterator(root_cells, max_level);
+  iterator.setOwnedRoots(owned_roots);
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  unsigned old_number_owned_leaves{0};
+  if (!field_registry.empty()) {
+    collectLeafLevels(old_levels, old_owned);
+    old_number_owned_leaves = countOwnedLeaves();
+  }
+
+  // Balancing mesh
+  beginAdaptationLog();
+  const unsigned number_rounds = ghostManager.balanceLevels(iterator, extrapolation_function, cell_index.get());
+  endAdaptationLog();
+  if (!field_registry.empty() && countOwnedLeaves() != old_number_owned_leaves)
+    remapFields(old_levels, old_owned);
+  return number_rounds;
 }
 
 // Creation of ghost cells
 template<typename CellType, typename TreeIteratorType>
 typename Tree<CellType, TreeIteratorType>::GhostManagerTaskType Tree<CellType, TreeIteratorType>::buildGhostLayer(InterpolationFunctionType interpolation_function, const std::vector<int> &directions) {
   TreeIteratorType iterator(root_cells, max_level);
-  return ghostManager.buildGhostLayer(root_cells, iterator, directions, interpolation_function);
+  iterator.setOwnedRoots(owned_roots);
+  if (field_registry.empty())
+    return ghostManager.buildGhostLayer(root_cells, iterator, directions, interpolation_function, cell_index.get());
+
+  // Owned leaves split by the received ghost cells (2:1 balance not restored by balanceLevels beforehand)
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  collectLeafLevels(old_levels, old_owned);
+  const unsigned old_number_owned_leaves = countOwnedLeaves();
+
+  GhostManagerTaskType task = ghostManager.buildGhostLayer(root_cells, iterator, directions, interpolation_function, cell_index.get());
+  if (countOwnedLeaves() != old_number_owned_leaves)
+    remapFields(old_levels, old_owned);
+  return task;
 }
 
 // Creation of ghost cells
@@ -120,15 +316,66 @@ void Tree<CellType, TreeIteratorType>::exchangeGhostValues(GhostManagerTaskType
 // Coarse all the cells for which all child are set to be coarsened
 template<typename CellType, typename TreeIteratorType>
 bool Tree<CellType, TreeIteratorType>::coarsen(InterpolationFunctionType interpolation_function) {
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  if (!field_registry.empty())
+    collectLeafLevels(old_levels, old_owned);
+
 	// Coarsening mesh
-	return coarseManager.coarsen(root_cells, interpolation_function);
+  beginAdaptationLog();
+  const bool structure_changed = coarseManager.coarsen(root_cells, interpolation_function);
+  endAdaptationLog();
+  if (structure_changed && !field_registry.empty())
+    remapFields(old_levels, old_owned);
+  return structure_changed;
+}
+
+// Coarse all the cells for which all child are set to be coarsened (verification and interpolation on a thread pool)
+template<typename CellType, typename TreeIteratorType>
+bool Tree<CellType, TreeIteratorType>::coarsen(InterpolationFunctionType interpolation_function, WorkStealingPool &pool) {
+  std::vector<unsigned char> old_levels;
+  std::vector<bool> old_owned;
+  if (!field_registry.empty())
+    collectLeafLevels(old_levels, old_owned);
+
+	// Coarsening mesh
+  beginAdaptationLog();
+  const bool structure_changed = coarseManager.coarsen(root_cells, interpolation_function, &pool);
+  endAdaptationLog();
+  if (structure_changed && !field_registry.empty())
+    remapFields(old_levels, old_owned);
+  return structure_changed;
 }
 
 // Redistribute cells among processes to balance computation load
 template<typename CellType, typename TreeIteratorType>
 void Tree<CellType, TreeIteratorType>::loadBalance(InterpolationFunctionType interpolation_function, const double max_pct_unbalance) {
 	TreeIteratorType iterator(root_cells, max_level);
-  return balanceManager.loadBalance(root_cells, iterator, max_pct_unbalance, interpolation_function);
+  iterator.setOwnedRoots(owned_roots);
+  const bool track_leaves = adaptation_log || !field_registry.empty();
+  const unsigned old_number_owned_leaves = track_leaves ? countOwnedLeaves() : 0;
+  beginAdaptationLog();
+  balanceManager.loadBalance(root_cells, iterator, max_pct_unbalance, interpolation_function);
+  endAdaptationLog();
+  updateOwnedRoots();
+  if (!track_leaves)
+    return;
+
+  // Owned leaves keep their global SFC order: the migrated ranges are the overlaps of the old and new partitions and
+  // the fields values are moved with the owned leaves (the counts are gathered once for both)
+  std::vector<unsigned> old_counts, new_counts;
+  scalarAllgather<unsigned>(old_number_owned_leaves, old_counts, size);
+  scalarAllgather<unsigned>(countOwnedLeaves(), new_counts, size);
+  if (adaptation_log)
+    adaptation_log->addMigratedRanges(old_counts, new_counts, rank);
+  if (!field_registry.empty())
+    field_registry.redistribute(old_counts, new_counts, rank);
+}
+
+// Update the range of the root cells belonging to this process (after changing the ownership flags outside the tree)
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::updateOwnedRoots() {
+  owned_roots = findOwnedRootRange(root_cells, owned_roots);
 }
 
 // Count the number of owned leaf cells
@@ -136,9 +383,11 @@ template<typename CellType, typename TreeIteratorType>
 unsigned Tree<CellType, TreeIteratorType>::countOwnedLeaves() const {
   unsigned nb_owned_leaves = 0;
 
-  for (const auto &root_cell : root_cells)
-    if (root_cell->belongToThisProc())
-      nb_owned_leaves += root_cell->countOwnedLeaves();
+  // Only the owned roots are visited (the range is checked in case the flags were changed outside the tree)
+  const std::pair<unsigned, unsigned> owned_range = findOwnedRootRange(root_cells, owned_roots);
+  for (unsigned i{owned_range.first}; i<owned_range.second; ++i)
+    if (root_cells[i]->belongToThisProc())
+      nb_owned_leaves += root_cells[i]->countOwnedLeaves();
   return nb_owned_leaves;
 }
 
@@ -172,10 +421,12 @@ unsigned Tree<CellType, TreeIteratorType>::countGhostLeaves() const {
   return nb_ghost_leaves;
 }
 
-// Apply a function to owned leaf cells
+// Apply a function to owned leaf cells (any callable taking the cell and its owned leaf position)
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::applyToOwnedLeaves(const std::function<void(const std::shared_ptr<CellType>&, const unsigned)> &f) const {
-  TreeIteratorType iterator(getRootCells(), getMaxLevel());
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToOwnedLeaves(Function &&f) const {
+  SfcLeafIteratorType iterator(getRootCells(), getMaxLevel());
+  iterator.setOwnedRoots(owned_roots);
 
   unsigned index{0};
   if (!iterator.toOwnedBegin())
@@ -185,9 +436,113 @@ void Tree<CellType, TreeIteratorType>::applyToOwnedLeaves(const std::function<vo
   } while (iterator.ownedNext());
 }
 
-// Apply a function to all cells
+// Apply a function to batches of N consecutive owned leaf cells (any callable taking a LeafBatch)
+template<typename CellType, typename TreeIteratorType>
+template<unsigned N, typename Function>
+void Tree<CellType, TreeIteratorType>::applyToOwnedLeafBatches(Function &&f) const {
+  SfcLeafIteratorType iterator(getRootCells(), getMaxLevel());
+  iterator.setOwnedRoots(owned_roots);
+  LeafBatch<CellType, N> batch;
+
+  unsigned index{0};
+  if (!iterator.toOwnedBegin())
+    return;
+  bool loop;
+  do {
+    // Fill the lanes with the next owned leaves
+    unsigned lane{0};
+    batch.first_index = index;
+    do {
+      batch.cells[lane] = iterator.getCellPtr();
+      batch.levels[lane] = static_cast<unsigned char>(iterator.getLevel());
+      batch.indices[lane] = index++;
+      ++lane;
+      loop = iterator.ownedNext();
+    } while (loop && lane<N);
+    batch.size = lane;
+
+    // Tail batch: repeat the last valid leaf
+    for (; lane<N; ++lane) {
+      batch.cells[lane] = batch.cells[batch.size-1];
+      batch.levels[lane] = batch.levels[batch.size-1];
+      batch.indices[lane] = batch.indices[batch.size-1];
+    }
+    f(static_cast<const LeafBatch<CellType, N>&>(batch));
+  } while (loop);
+}
+
+// Apply a function to owned leaf cells on a thread pool (chunk level giving about 16 chunks per thread)
+template<typename CellType, typename TreeIteratorType>
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToOwnedLeavesParallel(Function &&f, WorkStealingPool &pool) const {
+  unsigned chunk_level{0};
+  for (unsigned long number_chunks = root_cells.size(); number_chunks<16ul*pool.getNumberThreads() && chunk_level<max_level; number_chunks *= CellType::number_children)
+    ++chunk_level;
+  applyToOwnedLeavesParallel(std::forward<Function>(f), pool, chunk_level);
+}
+
+// Apply a function to owned leaf cells on a thread pool (any callable taking the cell, its owned leaf position and
+// the thread index, called concurrently): the owned SFC range is split in subtrees at the chunk level
+template<typename CellType, typename TreeIteratorType>
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToOwnedLeavesParallel(Function &&f, WorkStealingPool &pool, const unsigned chunk_level) const {
+  // Owned cells at the chunk level (or leaf cells above it) along the SFC
+  std::vector<CellKeyType> chunk_keys;
+  std::vector<const CellType*> chunk_cells;
+  {
+    SfcLeafIteratorType iterator(root_cells, max_level);
+    iterator.setOwnedRoots(owned_roots);
+    if (!iterator.toOwnedBegin(chunk_level))
+      return;
+    do {
+      chunk_keys.push_back(iterator.getCellKey());
+      chunk_cells.push_back(iterator.getCellPtr());
+    } while (iterator.ownedNext(chunk_level));
+  }
+
+  // Position of the first owned leaf of each chunk
+  std::vector<unsigned> chunk_begins(chunk_keys.size()+1, 0);
+  pool.run(chunk_keys.size(), [&chunk_cells, &chunk_begins](const unsigned chunk, const unsigned thread) {
+    (void)thread;
+    chunk_begins[chunk+1] = chunk_cells[chunk]->countOwnedLeaves();
+  });
+  std::partial_sum(chunk_begins.begin(), chunk_begins.end(), chunk_begins.begin());
+
+  // Sweep the owned leaves of each chunk with the leaf iterator of the thread
+  std::vector<SfcLeafIteratorType> iterators(pool.getNumberThreads(), SfcLeafIteratorType(root_cells, max_level));
+  pool.run(chunk_keys.size(), [&f, &chunk_keys, &chunk_begins, &iterators](const unsigned chunk, const unsigned thread) {
+    SfcLeafIteratorType &iterator = iterators[thread];
+    iterator.toCellKey(chunk_keys[chunk]);
+    iterator.toOwnedLeaf();
+    unsigned index{chunk_begins[chunk]};
+    f(iterator.getCell(), index, thread);
+    while (++index < chunk_begins[chunk+1]) {
+      iterator.ownedNext();
+      f(iterator.getCell(), index, thread);
+    }
+  });
+}
+
+// Apply a function to the owned (or ghost) cells of a level along the SFC (any callable taking the cell and its
+// position among the visited cells)
+template<typename CellType, typename TreeIteratorType>
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToLevel(const unsigned level, Function &&f, const bool ghost) const {
+  if (!level_index)
+    throw std::runtime_error("Root cells not created in Tree::applyToLevel()");
+
+  unsigned index{0};
+  for (const auto &entry : level_index->getLevel(level)) {
+    const std::shared_ptr<CellType> &cell = *entry.cell;
+    if (ghost ? cell->belongToOtherProc() : cell->belongToThisProc())
+      f(cell, index++);
+  }
+}
+
+// Apply a function to all cells (any callable taking the cell and its position)
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::applyToAllCells(const std::function<void(const std::shared_ptr<CellType>&, const unsigned)> &f) const {
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToAllCells(Function &&f) const {
   unsigned index{0};
   for (const auto &root_cell : root_cells) {
     f(root_cell, index++);
@@ -196,76 +551,81 @@ void Tree<CellType, TreeIteratorType>::applyToAllCells(const std::function<void(
 }
 
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::sharePartitions(std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids) const {
+void Tree<CellType, TreeIteratorType>::sharePartitions(std::vector<CellKeyType> &begin_keys, std::vector<CellKeyType> &end_keys) const {
   TreeIteratorType iterator(root_cells, max_level);
-  sharePartitions(begin_ids, end_ids, iterator);
+  iterator.setOwnedRoots(owned_roots);
+  sharePartitions(begin_keys, end_keys, iterator);
 }
 
 // Share the partiion start and end cells
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::sharePartitions(std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids, TreeIteratorType &iterator) const {
-  ghostManager.sharePartitions(begin_ids, end_ids, iterator);
+void Tree<CellType, TreeIteratorType>::sharePartitions(std::vector<CellKeyType> &begin_keys, std::vector<CellKeyType> &end_keys, TreeIteratorType &iterator) const {
+  ghostManager.sharePartitions(begin_keys, end_keys, iterator);
 }
 
 // Share the partiion start and end cells
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::applyToGhostLeavesRanks(const std::function<void(const std::shared_ptr<CellType>&, const unsigned, const unsigned)> &f) const {
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToGhostLeavesRanks(Function &&f) const {
   TreeIteratorType iterator(root_cells, max_level);
+  iterator.setOwnedRoots(owned_roots);
   applyToGhostLeavesRanks(f, iterator);
 }
 
 // Apply a function to owned leaf cells
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::applyToGhostLeavesRanks(const std::function<void(const std::shared_ptr<CellType>&, const unsigned, const unsigned)> &f, TreeIteratorType &iterator) const {
-  std::vector<std::vector<unsigned>> partitions_begin_ids, partitions_end_ids;
-  sharePartitions(partitions_begin_ids, partitions_end_ids, iterator);
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToGhostLeavesRanks(Function &f, TreeIteratorType &iterator) const {
+  std::vector<CellKeyType> partitions_begin_keys, partitions_end_keys;
+  sharePartitions(partitions_begin_keys, partitions_end_keys, iterator);
 
   // Process has no ghost cells
   unsigned index{0};
   if (!iterator.toOwnedBegin()) {
     iterator.toBegin();
-    applyToGhostLeaves(f, partitions_begin_ids, partitions_end_ids, index, iterator);
+    applyToGhostLeaves(f, partitions_begin_keys, partitions_end_keys, index, iterator);
     return;
   }
 
   // Determine if there is any rank lower that have ghost cells and loop through them
   {
     iterator.toOwnedBegin();
-    std::shared_ptr<CellType> owned_begin_cell = iterator.getCell();
+    const CellType *owned_begin_cell = iterator.getCellPtr();
     iterator.toBegin();
-    if (iterator.getCell() != owned_begin_cell)
-      applyToGhostLeaves(f, partitions_begin_ids, partitions_end_ids, index, iterator); // Loop through ghost from begin to owned begin - 1
+    if (iterator.getCellPtr() != owned_begin_cell)
+      applyToGhostLeaves(f, partitions_begin_keys, partitions_end_keys, index, iterator); // Loop through ghost from begin to owned begin - 1
   }
 
   // Determine if there is any rank higher that have ghost cells and loop through them
   {
     iterator.toEnd();
-    std::shared_ptr<CellType> end_cell = iterator.getCell();
+    const CellType *end_cell = iterator.getCellPtr();
     iterator.toOwnedEnd();
-    if (iterator.getCell() != end_cell) {
+    if (iterator.getCellPtr() != end_cell) {
       iterator.next();
-      applyToGhostLeaves(f, partitions_begin_ids, partitions_end_ids, index, iterator); // Loop through ghost from owned end + 1 to end
+      applyToGhostLeaves(f, partitions_begin_keys, partitions_end_keys, index, iterator); // Loop through ghost from owned end + 1 to end
     }
   }
 }
 
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::applyToGhostLeaves(const std::function<void(const std::shared_ptr<CellType>&, const unsigned, const unsigned)> &f, std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids, unsigned &index, TreeIteratorType &iterator) const {
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToGhostLeaves(Function &f, const std::vector<CellKeyType> &begin_keys, const std::vector<CellKeyType> &end_keys, unsigned &index, TreeIteratorType &iterator) const {
   unsigned other_rank = 0;
   auto cell_id_manager = iterator.getCellIdManager();
   bool loop{true};
   do {
     // If empty partition skip
-    if (!cell_id_manager.cellIdLte(begin_ids[other_rank], end_ids[other_rank])) {
+    if (!cell_id_manager.cellKeyLte(begin_keys[other_rank], end_keys[other_rank])) {
       other_rank++;
       continue;
     }
 
-    std::shared_ptr<CellType> cell = iterator.getCell();
+    const std::shared_ptr<CellType> &cell = iterator.getCell();
 
-    if (iterator.cellIdLte(end_ids[other_rank])) // Cell is in the proc partition -> callback + next cell (no next rank)
+    if (iterator.cellKeyLte(end_keys[other_rank])) // Cell is in the proc partition -> callback + next cell (no next rank)
       f(cell, index++, other_rank);
-    else if (!iterator.cellIdGt(end_ids[other_rank])) { // Cell may be shared between partitions -> callback + next rank (no next cell)
+    else if (!iterator.cellKeyGt(end_keys[other_rank])) { // Cell may be shared between partitions -> callback + next rank (no next cell)
       f(cell, index++, other_rank);
       other_rank++;
       continue;
@@ -274,16 +634,71 @@ void Tree<CellType, TreeIteratorType>::applyToGhostLeaves(const std::function<vo
       continue;
     }
     // Move iterator and check if still in partition
-    loop = iterator.next() && iterator.getCell()->belongToOtherProc();
+    loop = iterator.next() && iterator.getCellPtr()->belongToOtherProc();
   } while (loop);
 }
 
 // Recursively apply a function to all child cells
 template<typename CellType, typename TreeIteratorType>
-void Tree<CellType, TreeIteratorType>::applyToAllCellsRecurs(const std::shared_ptr<CellType> &cell, const std::function<void(const std::shared_ptr<CellType>&, const unsigned)> &f, unsigned &index) const {
+template<typename Function>
+void Tree<CellType, TreeIteratorType>::applyToAllCellsRecurs(const std::shared_ptr<CellType> &cell, Function &f, unsigned &index) const {
   if (!cell->isLeaf())
     for (auto &child : cell->getChildCells()) {
       f(child, index++);
       applyToAllCellsRecurs(child, f, index);
     }
 }
+
+// Start recording the changes of an adaptation call (if the log is enabled)
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::beginAdaptationLog() {
+  if (!adaptation_log)
+    return;
+  adaptation_log->clear();
+  oct_allocator->removeListener(adaptation_log.get());
+  oct_allocator->addListener(adaptation_log.get());
+}
+
+// Stop recording the changes and sort them along the SFC
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::endAdaptationLog() {
+  if (!adaptation_log)
+    return;
+  oct_allocator->removeListener(adaptation_log.get());
+  adaptation_log->sortFamilies();
+}
+
+// Get the owned leaf cells along the SFC
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::collectOwnedLeaves(std::vector<CellType*> &cells) const {
+  cells.clear();
+  applyToOwnedLeaves([&cells](const std::shared_ptr<CellType> &cell, const unsigned index) {
+    (void)index;
+    cells.push_back(cell.get());
+  });
+}
+
+// Get the levels and ownership of all the leaves along the SFC (for remapping the fields)
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::collectLeafLevels(std::vector<unsigned char> &levels, std::vector<bool> &owned) const {
+  levels.clear();
+  owned.clear();
+  if (root_cells.empty())
+    return;
+
+  SfcLeafIteratorType iterator(root_cells, max_level);
+  iterator.toBegin();
+  do {
+    levels.push_back(static_cast<unsigned char>(iterator.getCellPtr()->getLevel()));
+    owned.push_back(iterator.getCellPtr()->belongToThisProc());
+  } while (iterator.next());
+}
+
+// Remap the fields after a structure change given the leaves before the change
+template<typename CellType, typename TreeIteratorType>
+void Tree<CellType, TreeIteratorType>::remapFields(const std::vector<unsigned char> &old_levels, const std::vector<bool> &old_owned) {
+  std::vector<unsigned char> new_levels;
+  std::vector<bool> new_owned;
+  collectLeafLevels(new_levels, new_owned);
+  field_registry.remap(old_levels, old_owned, new_levels, new_owned, CellType::number_children);
+}
@@ -4,10 +4,12 @@
  *  Licensed under the MIT License (see LICENSE file in project root)
  *
  *  Description: Abstract class for iterating through tree cells.
+ *  The curve is provided by the derived iterator (CRTP), so the curve steps are inlined in the traversals.
  */
 
 #pragma once
 
+#include <array>
 #include <limits>
 #include <memory>
 #include <stack>
@@ -15,11 +17,13 @@
 #include <vector>
 
 #include "../manager/CellIdManager.h"
+#include "owned_root_range.h"
 
-template<typename CellType>
+template<typename CellType, typename DerivedIteratorType>
 class AbstractTreeIterator {
  public:
   using CellIdManagerType = CellIdManager<CellType>;
+  using CellKeyType = typename CellIdManagerType::CellKeyType;
   using ExtrapolationFunctionType = std::function<void(const std::shared_ptr<CellType>&)>;
 
   //***********************************************************//
@@ -36,14 +40,16 @@ class AbstractTreeIterator {
  private:
   // Vector of orders
   std::vector<unsigned> order_path;
-  // Current cell pointed by iterator
-  std::shared_ptr<CellType> current_cell;
+  // Current cell pointed by iterator (non-owning)
+  CellType *current_cell;
   // Size of partition for each level
   std::vector<size_t> level_partition_sizes;
   // Partition of the current cell
   std::pair<int, int> current_cell_partition;
-  // Partition of the current cell
-  std::vector<unsigned> current_cell_id;
+  // Packed key of the current cell
+  CellKeyType current_cell_key;
+  // Range of the root cells belonging to this process (guess checked in constant time)
+  std::pair<unsigned, unsigned> owned_roots;
   // Cell ID manager
   CellIdManagerType cell_id_manager;
 
@@ -54,14 +60,16 @@ class AbstractTreeIterator {
   // Constructor
   AbstractTreeIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level);
   // Destructor
-  virtual ~AbstractTreeIterator() = default;
+  ~AbstractTreeIterator() = default;
 
   //***********************************************************//
   //  ACCESSORS                                                //
   //***********************************************************//
  public:
+  // Get current cell (as a smart pointer for callbacks taking shared_ptr)
+  const std::shared_ptr<CellType>& getCell() const;
   // Get current cell
-  std::shared_ptr<CellType> getCell() const;
+  CellType* getCellPtr() const { return current_cell; };
   // Get current cell partition
   const std::pair<int, int>& getPartition() const;
   // Get current index path
@@ -70,13 +78,30 @@ class AbstractTreeIterator {
   const std::vector<unsigned>& getOrderPath() const;
   // Get current cell ID
   std::vector<unsigned> getCellId() const;
+  // Get current cell key
+  CellKeyType getCellKey() const { return current_cell_key; };
   // Get cell ID manager
-  CellIdManagerType getCellIdManager() const;
+  const CellIdManagerType& getCellIdManager() const;
   // Construct cell index path
-  std::vector<unsigned> getCellId(const std::shared_ptr<CellType> &cell) const;
+  std::vector<unsigned> getCellId(const std::shared_ptr<CellType> &cell) const { return getCellId(cell.get()); };
+  std::vector<unsigned> getCellId(const CellType *cell) const;
+  // Construct cell key
+  CellKeyType getCellKey(const std::shared_ptr<CellType> &cell) const { return getCellKey(cell.get()); };
+  CellKeyType getCellKey(const CellType *cell) const;
+  // Construct cell key and get the curve orientation of the cell (climbs to the root without allocating)
+  CellKeyType getCellKey(const CellType *cell, unsigned &orientation) const;
+
+  //***********************************************************//
+  //  MUTATORS                                                 //
+  //***********************************************************//
+ public:
+  // Set the range of the root cells belonging to this process (avoids scanning the roots)
+  void setOwnedRoots(const std::pair<unsigned, unsigned> &owned_roots) { this->owned_roots = owned_roots; };
  private:
   // Construct cell index path
-  std::vector<unsigned> getCellIndexPath(const std::shared_ptr<CellType> &cell) const;
+  std::vector<unsigned> getCellIndexPath(const CellType *cell) const;
+  // Index of a root cell in the root cells
+  unsigned getRootNumber(const CellType *root_cell) const;
 
   //***********************************************************//
   //  METHODS                                                  //
@@ -104,36 +129,64 @@ class AbstractTreeIterator {
   void toOwnedLeaf(const unsigned sweep_level = std::numeric_limits<int>::max(), const bool reverse = false);
   // Move iterator to a specific cell ID (can also create it with a flag)
   void toCellId(const std::vector<unsigned> &cell_id, const bool create = false, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Move iterator to a specific cell key (can also create it with a flag)
+  void toCellKey(const CellKeyType cell_key, const bool create = false, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Move iterator to a specific cell key from the current cell by climbing to their common ancestor only (the current cell
+  // must not have been removed since the iterator last moved)
+  void seekCellKey(const CellKeyType cell_key, const bool create = false, const ExtrapolationFunctionType &extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Move iterator to the cells of a list of keys and apply a function to each of them (any callable taking the cell and
+  // its position in the list): keys sorted along the curve cost an amortized constant time per cell
+  template<typename Function>
+  void toCellKeys(const std::vector<CellKeyType> &cell_keys, const bool create, Function &&f, const ExtrapolationFunctionType &extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
+  // Move iterator to the cells of a list of cell IDs and apply a function to each of them (see toCellKeys)
+  template<typename Function>
+  void toCellIds(const std::vector<std::vector<unsigned>> &cell_ids, const bool create, Function &&f, const ExtrapolationFunctionType &extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
   // Move iterator to a specific cell index path (can also create it with a flag)
   void toIndexPath(const std::vector<unsigned> &index_path, const bool create, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; });
   // Check if a cell ID is greater than
-  bool cellIdGt(const std::vector<unsigned> &cell_id) const { return cell_id_manager.cellIdGt(current_cell_id, cell_id); }
+  bool cellIdGt(const std::vector<unsigned> &cell_id) const { return cellKeyGt(cell_id_manager.idToKey(cell_id)); }
   // Check if a cell ID is greater than or equal another ID
-  bool cellIdGte(const std::vector<unsigned> &cell_id) const { return cell_id_manager.cellIdGte(current_cell_id, cell_id); }
+  bool cellIdGte(const std::vector<unsigned> &cell_id) const { return cellKeyGte(cell_id_manager.idToKey(cell_id)); }
   // Check if a cell ID is smaller than
-  bool cellIdLt(const std::vector<unsigned> &cell_id) const { return cell_id_manager.cellIdLt(current_cell_id, cell_id); }
+  bool cellIdLt(const std::vector<unsigned> &cell_id) const { return cellKeyLt(cell_id_manager.idToKey(cell_id)); }
   // Check if a cell ID is smaller than or equal another ID
-  bool cellIdLte(const std::vector<unsigned> &cell_id) const { return cell_id_manager.cellIdLte(current_cell_id, cell_id); }
+  bool cellIdLte(const std::vector<unsigned> &cell_id) const { return cellKeyLte(cell_id_manager.idToKey(cell_id)); }
+  // Check if a cell key is greater than
+  bool cellKeyGt(const CellKeyType cell_key) const { return cell_id_manager.cellKeyGt(current_cell_key, cell_key); }
+  // Check if a cell key is greater than or equal another key
+  bool cellKeyGte(const CellKeyType cell_key) const { return cell_id_manager.cellKeyGte(current_cell_key, cell_key); }
+  // Check if a cell key is smaller than
+  bool cellKeyLt(const CellKeyType cell_key) const { return cell_id_manager.cellKeyLt(current_cell_key, cell_key); }
+  // Check if a cell key is smaller than or equal another key
+  bool cellKeyLte(const CellKeyType cell_key) const { return cell_id_manager.cellKeyLte(current_cell_key, cell_key); }
   // Generate an ID from the genealogy of a cell
   std::vector<unsigned> indexPathToId(const std::vector<unsigned> &index_path) const;
   // Generate an ID from the genealogy of a cell
   std::vector<unsigned> orderPathToId(const std::vector<unsigned> &order_path) const;
   // Generate an ID from the genealogy of a cell
   std::vector<unsigned> idToOrderPath(const std::vector<unsigned> &cell_id) const;
+  // The derived iterator provides:
+  //  - std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const;
+  //  - std::vector<unsigned> orderToIndexPath(const std::vector<unsigned> &order_path) const;
+  //  - unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const;
+  //  - unsigned getRootOrientation(const unsigned root_number) const;
+  //  - unsigned getChildOrientation(const unsigned orientation, const unsigned order) const;
+  //  - unsigned getChildOrder(const unsigned orientation, const unsigned sibling_number) const;
+  // and may hide toChild, toParent and toRoot to follow the curve orientation (calling the ones below).
  protected:
-  // Converts the genealogy of a cell
-  virtual std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const = 0;
-  // Return the sibling number from the order (number along
-  // the curve) with respect to the mother orientation.
-  virtual unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const = 0;
+  // Derived iterator (static dispatch of the curve steps)
+  DerivedIteratorType& derived() { return static_cast<DerivedIteratorType&>(*this); };
+  const DerivedIteratorType& derived() const { return static_cast<const DerivedIteratorType&>(*this); };
   // Go to child cell
-  virtual void toChild(const unsigned order);
+  void toChild(const unsigned order);
   // Go to parent cell
-  virtual void toParent();
+  void toParent();
   // Go to root cell
-  virtual void toRoot(const unsigned root_number);
+  void toRoot(const unsigned root_number);
+  // Go down from the current cell to the cell of a key (the current cell must be an ancestor)
+  void descendToCellKey(const CellKeyType cell_key, const bool create, const ExtrapolationFunctionType &extrapolation_function);
   // Return the child cell from order and mother cell orientation (obtained by following the curve)
-  std::shared_ptr<CellType> getChildCellFromOrder(std::shared_ptr<CellType> cell, unsigned order, const bool compute_orientation=false);
+  CellType* getChildCellFromOrder(const CellType *cell, unsigned order, const bool compute_orientation=false);
 };
 
 #include "AbstractTreeIterator.tpp"
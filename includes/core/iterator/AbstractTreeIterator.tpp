@@ -5,10 +5,13 @@
 //***********************************************************//
 
 // Constructor
-template<typename CellType>
-AbstractTreeIterator<CellType>::AbstractTreeIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
+template<typename CellType, typename DerivedIteratorType>
+AbstractTreeIterator<CellType, DerivedIteratorType>::AbstractTreeIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
 : root_cells(root_cells),
   max_level(max_level),
+  current_cell(nullptr),
+  current_cell_key(0),
+  owned_roots(0, root_cells.size()),
   cell_id_manager(root_cells.size(), max_level) {
   level_partition_sizes.assign(max_level+1, 1);
   for (int i=(max_level-1); i>=0; --i)
@@ -19,203 +22,236 @@ AbstractTreeIterator<CellType>::AbstractTreeIterator(const std::vector<std::shar
   order_path.reserve(max_level+1);
   order_path.resize(1);
   order_path[0] = 0;
-  cell_id_manager.resetCellID(current_cell_id);
 }
 
 //***********************************************************//
 //  ACCESSORS                                                //
 //***********************************************************//
 
-// Get current cell
-template<typename CellType>
-std::shared_ptr<CellType> AbstractTreeIterator<CellType>::getCell() const {
-  return current_cell;
+// Get current cell (as a smart pointer for callbacks taking shared_ptr)
+template<typename CellType, typename DerivedIteratorType>
+const std::shared_ptr<CellType>& AbstractTreeIterator<CellType, DerivedIteratorType>::getCell() const {
+  static const std::shared_ptr<CellType> null_cell;
+  if (!current_cell)
+    return null_cell;
+  if (current_cell->isRoot())
+    return root_cells[index_path[0]];
+  return current_cell->getParentOct()->getChildCells()[index_path.back()];
 }
 
 // Get current cell partition
-template<typename CellType>
-const std::pair<int, int>& AbstractTreeIterator<CellType>::getPartition() const {
+template<typename CellType, typename DerivedIteratorType>
+const std::pair<int, int>& AbstractTreeIterator<CellType, DerivedIteratorType>::getPartition() const {
   return current_cell_partition;
 }
 
 // Get current index path
-template<typename CellType>
-const std::vector<unsigned>& AbstractTreeIterator<CellType>::getIndexPath() const {
+template<typename CellType, typename DerivedIteratorType>
+const std::vector<unsigned>& AbstractTreeIterator<CellType, DerivedIteratorType>::getIndexPath() const {
   return index_path;
 };
 
 // Get current order path
-template<typename CellType>
-const std::vector<unsigned>& AbstractTreeIterator<CellType>::getOrderPath() const {
+template<typename CellType, typename DerivedIteratorType>
+const std::vector<unsigned>& AbstractTreeIterator<CellType, DerivedIteratorType>::getOrderPath() const {
   return order_path;
 };
 
 // Get current cell ID
-template<typename CellType>
-std::vector<unsigned> AbstractTreeIterator<CellType>::getCellId() const {
-  return current_cell_id;
+template<typename CellType, typename DerivedIteratorType>
+std::vector<unsigned> AbstractTreeIterator<CellType, DerivedIteratorType>::getCellId() const {
+  return cell_id_manager.keyToId(current_cell_key);
 }
 
 // Get cell ID manager
-template<typename CellType>
-typename AbstractTreeIterator<CellType>::CellIdManagerType AbstractTreeIterator<CellType>::getCellIdManager() const {
+template<typename CellType, typename DerivedIteratorType>
+const typename AbstractTreeIterator<CellType, DerivedIteratorType>::CellIdManagerType& AbstractTreeIterator<CellType, DerivedIteratorType>::getCellIdManager() const {
   return cell_id_manager;
 };
 
 // Construct cell id
-template<typename CellType>
-std::vector<unsigned> AbstractTreeIterator<CellType>::getCellId(const std::shared_ptr<CellType> &cell) const {
+template<typename CellType, typename DerivedIteratorType>
+std::vector<unsigned> AbstractTreeIterator<CellType, DerivedIteratorType>::getCellId(const CellType *cell) const {
   return indexPathToId(getCellIndexPath(cell));
 }
 
+// Construct cell key
+template<typename CellType, typename DerivedIteratorType>
+typename AbstractTreeIterator<CellType, DerivedIteratorType>::CellKeyType AbstractTreeIterator<CellType, DerivedIteratorType>::getCellKey(const CellType *cell) const {
+  unsigned orientation;
+  return getCellKey(cell, orientation);
+}
+
+// Construct cell key and get the curve orientation of the cell (climbs to the root without allocating)
+template<typename CellType, typename DerivedIteratorType>
+typename AbstractTreeIterator<CellType, DerivedIteratorType>::CellKeyType AbstractTreeIterator<CellType, DerivedIteratorType>::getCellKey(const CellType *cell, unsigned &orientation) const {
+  // Sibling numbers up to the root (the level is stored on a byte in the cell header)
+  std::array<unsigned char, std::numeric_limits<unsigned char>::max()+1> sibling_numbers;
+  const unsigned level = cell->getLevel();
+  const CellType *parent = cell;
+  for (unsigned l{level}; l>0; --l) {
+    sibling_numbers[l] = static_cast<unsigned char>(parent->getSiblingNumber());
+    parent = parent->getParentOct()->getParentCell();
+  }
+
+  // Follow the curve down to the cell
+  const unsigned root_number = getRootNumber(parent);
+  orientation = derived().getRootOrientation(root_number);
+  CellKeyType cell_key = cell_id_manager.rootKey(root_number);
+  for (unsigned l{1}; l<=level; ++l) {
+    const unsigned order = derived().getChildOrder(orientation, sibling_numbers[l]);
+    cell_key = cell_id_manager.childKey(cell_key, order);
+    orientation = derived().getChildOrientation(orientation, order);
+  }
+  return cell_key;
+}
+
 // Construct cell index path
-template<typename CellType>
-std::vector<unsigned> AbstractTreeIterator<CellType>::getCellIndexPath(const std::shared_ptr<CellType> &cell) const {
+template<typename CellType, typename DerivedIteratorType>
+std::vector<unsigned> AbstractTreeIterator<CellType, DerivedIteratorType>::getCellIndexPath(const CellType *cell) const {
   std::vector<unsigned> cell_index_path(cell->getLevel()+1);
   // Browse parents until root  to extract index path
-  std::shared_ptr<CellType> parent = cell;
+  const CellType *parent = cell;
   for (unsigned l{parent->getLevel()}; l>0; --l) {
     cell_index_path[l] = parent->getSiblingNumber();
     parent = parent->getParentOct()->getParentCell();
   }
   // Find the associated root (parent should be a root now)
-  for (size_t i{0}; i<root_cells.size(); ++i)
-    if (root_cells[i] == parent)
-      cell_index_path[0] = i;
+  cell_index_path[0] = getRootNumber(parent);
 
   return cell_index_path;
 }
 
+// Index of a root cell in the root cells (from the cell header)
+template<typename CellType, typename DerivedIteratorType>
+unsigned AbstractTreeIterator<CellType, DerivedIteratorType>::getRootNumber(const CellType *root_cell) const {
+  const unsigned root_index = root_cell->getRootIndex();
+  if (root_index<root_cells.size() && root_cells[root_index].get()==root_cell)
+    return root_index;
+  // Roots not created by a tree
+  unsigned root_number{0};
+  for (size_t i{0}; i<root_cells.size(); ++i)
+    if (root_cells[i].get() == root_cell)
+      root_number = i;
+  return root_number;
+}
+
 //***********************************************************//
 //  METHODS                                                  //
 //***********************************************************//
 
 // Go to the next leaf cell
-template<typename CellType>
-bool AbstractTreeIterator<CellType>::next(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+bool AbstractTreeIterator<CellType, DerivedIteratorType>::next(const unsigned sweep_level) {
   unsigned current_order = order_path.back();
   if (current_order < (CellType::number_children-1)) { // Going to the next sibling
-    this->toParent();
-    this->toChild(current_order+1);
+    derived().toParent();
+    derived().toChild(current_order+1);
     toLeaf(sweep_level, false);
     return true;
   }
   if (order_path.size() > 2) { // Mother cell is not a root cell
-    this->toParent();
+    derived().toParent();
     return next(sweep_level);
   }
   // Mother cell is root cell
-  this->toRoot((index_path[0]+1) % root_cells.size());
+  derived().toRoot((index_path[0]+1) % root_cells.size());
   toLeaf(sweep_level, false);
   return index_path[0] != 0;
 }
 
 // Go to the next leaf cell belonging to this proc
-template<typename CellType>
-bool AbstractTreeIterator<CellType>::ownedNext(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+bool AbstractTreeIterator<CellType, DerivedIteratorType>::ownedNext(const unsigned sweep_level) {
   bool notLoop = next(sweep_level);
   return notLoop && current_cell->belongToThisProc();
 }
 
 // Go to the previous leaf cell
-template<typename CellType>
-bool AbstractTreeIterator<CellType>::prev(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+bool AbstractTreeIterator<CellType, DerivedIteratorType>::prev(const unsigned sweep_level) {
   unsigned current_order = order_path.back();
   if (current_order > 0) { // Going to the next sibling
-    this->toParent();
-    this->toChild(current_order-1);
+    derived().toParent();
+    derived().toChild(current_order-1);
     toLeaf(sweep_level, true);
     return true;
   }
   if (order_path.size() > 2) { // Mother cell is not a root cell
-    this->toParent();
+    derived().toParent();
     return prev(sweep_level);
   }
   // Mother cell is root cell
-  this->toRoot((index_path[0]+root_cells.size()-1) % root_cells.size());
+  derived().toRoot((index_path[0]+root_cells.size()-1) % root_cells.size());
   toLeaf(sweep_level, true);
   return index_path[0] != (root_cells.size()-1);
 }
 
 // Go to the previous leaf cell belonging to this proc
-template<typename CellType>
-bool AbstractTreeIterator<CellType>::ownedPrev(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+bool AbstractTreeIterator<CellType, DerivedIteratorType>::ownedPrev(const unsigned sweep_level) {
   bool notLoop = prev(sweep_level);
   return notLoop && current_cell->belongToThisProc();
 }
 
 // Go to the first leaf cell of first root
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toBegin(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toBegin(const unsigned sweep_level) {
   // Go to first root
-  this->toRoot(0);
+  derived().toRoot(0);
   toLeaf(sweep_level, false);
 }
 
 // Go to the first leaf cell of first root belonging to this process
-template<typename CellType>
-bool AbstractTreeIterator<CellType>::toOwnedBegin(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+bool AbstractTreeIterator<CellType, DerivedIteratorType>::toOwnedBegin(const unsigned sweep_level) {
   // Find first owned root
-  unsigned i;
-  bool found = false;
-  for (i=0; i<root_cells.size(); ++i)
-    if (root_cells[i]->belongToThisProc()) {
-      found = true;
-      break;
-    }
-
-  if (!found)
+  owned_roots = findOwnedRootRange(root_cells, owned_roots);
+  if (owned_roots.first == owned_roots.second)
     return false;
 
   // Go to first owned root
-  this->toRoot(i);
+  derived().toRoot(owned_roots.first);
   toOwnedLeaf(sweep_level, false);
   return true;
 }
 
 // Go to the last leaf cell of last root
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toEnd(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toEnd(const unsigned sweep_level) {
   // Go last root
-  this->toRoot(root_cells.size()-1);
+  derived().toRoot(root_cells.size()-1);
   toLeaf(sweep_level, true);
 }
 
 // Go to the last leaf cell of last root belonging to this process
-template<typename CellType>
-bool AbstractTreeIterator<CellType>::toOwnedEnd(const unsigned sweep_level) {
+template<typename CellType, typename DerivedIteratorType>
+bool AbstractTreeIterator<CellType, DerivedIteratorType>::toOwnedEnd(const unsigned sweep_level) {
   // Find last owned root
-  long int i;
-  bool found = false;
-  for (i=root_cells.size()-1; i>=0; --i)
-    if (root_cells[i]->belongToThisProc()) {
-      found = true;
-      break;
-    }
-
-  if (!found)
+  owned_roots = findOwnedRootRange(root_cells, owned_roots);
+  if (owned_roots.first == owned_roots.second)
     return false;
 
   // Go to last owned root
-  this->toRoot(i);
+  derived().toRoot(owned_roots.second-1);
   toOwnedLeaf(sweep_level, true);
   return true;
 }
 
 // Moves the iterator to a leaf cell of the current cell
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toLeaf(const unsigned sweep_level, const bool reverse) {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toLeaf(const unsigned sweep_level, const bool reverse) {
   while (!current_cell->isLeaf() && order_path.size()<=sweep_level)
     // Update current to child
     if (reverse)
-      this->toChild(CellType::number_children - 1);
+      derived().toChild(CellType::number_children - 1);
     else
-      this->toChild(0);
+      derived().toChild(0);
 }
 
 // Moves the iterator to a leaf cell of the current cell that belong to the process
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toOwnedLeaf(const unsigned sweep_level, const bool reverse) {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toOwnedLeaf(const unsigned sweep_level, const bool reverse) {
   while (!current_cell->isLeaf() && order_path.size()<=sweep_level) {
     long int order;
     if (reverse)
@@ -229,59 +265,100 @@ void AbstractTreeIterator<CellType>::toOwnedLeaf(const unsigned sweep_level, con
           break;
 
     // Update current to child
-    this->toChild(order);
+    derived().toChild(order);
   }
 }
 
 // Move iterator to a specific cell ID (can also create it with a flag)
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toCellId(const std::vector<unsigned> &cell_id, const bool create, ExtrapolationFunctionType extrapolation_function) {
-  std::vector<unsigned> order_path = idToOrderPath(cell_id);
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toCellId(const std::vector<unsigned> &cell_id, const bool create, ExtrapolationFunctionType extrapolation_function) {
+  toCellKey(cell_id_manager.idToKey(cell_id), create, extrapolation_function);
+}
 
-  // Go to right cell
-  this->toRoot(order_path[0]);
-  for (size_t i{1}; i<order_path.size(); ++i) {
-    if (create && current_cell->isLeaf())
-      current_cell->split(max_level, extrapolation_function);
-    if (!current_cell->isLeaf())
-      this->toChild(order_path[i]);
-    else
-      throw std::runtime_error("Cannot reach cell in AbstractTreeIterator::toCellId()");
+// Move iterator to a specific cell key (can also create it with a flag)
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toCellKey(const CellKeyType cell_key, const bool create, ExtrapolationFunctionType extrapolation_function) {
+  derived().toRoot(cell_id_manager.getKeyRoot(cell_key));
+  descendToCellKey(cell_key, create, extrapolation_function);
+}
+
+// Move iterator to a specific cell key from the current cell by climbing to their common ancestor only (the current cell
+// must not have been removed since the iterator last moved)
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::seekCellKey(const CellKeyType cell_key, const bool create, const ExtrapolationFunctionType &extrapolation_function) {
+  const int common_level = current_cell ? cell_id_manager.commonAncestorLevel(current_cell_key, cell_key) : -1;
+
+  // Different root cells
+  if (common_level < 0) {
+    derived().toRoot(cell_id_manager.getKeyRoot(cell_key));
+    descendToCellKey(cell_key, create, extrapolation_function);
+    return;
+  }
+
+  // Climb to the common ancestor then go down
+  while (order_path.size()-1 > static_cast<size_t>(common_level))
+    derived().toParent();
+  descendToCellKey(cell_key, create, extrapolation_function);
+}
+
+// Move iterator to the cells of a list of keys and apply a function to each of them (any callable taking the cell and
+// its position in the list): keys sorted along the curve cost an amortized constant time per cell
+template<typename CellType, typename DerivedIteratorType>
+template<typename Function>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toCellKeys(const std::vector<CellKeyType> &cell_keys, const bool create, Function &&f, const ExtrapolationFunctionType &extrapolation_function) {
+  for (size_t i{0}; i<cell_keys.size(); ++i) {
+    // The first cell is reached from the root as the iterator may point to a removed cell
+    if (i == 0) {
+      derived().toRoot(cell_id_manager.getKeyRoot(cell_keys[i]));
+      descendToCellKey(cell_keys[i], create, extrapolation_function);
+    } else
+      seekCellKey(cell_keys[i], create, extrapolation_function);
+    f(getCell(), static_cast<unsigned>(i));
   }
 }
 
+// Move iterator to the cells of a list of cell IDs and apply a function to each of them (see toCellKeys)
+template<typename CellType, typename DerivedIteratorType>
+template<typename Function>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toCellIds(const std::vector<std::vector<unsigned>> &cell_ids, const bool create, Function &&f, const ExtrapolationFunctionType &extrapolation_function) {
+  std::vector<CellKeyType> cell_keys(cell_ids.size());
+  for (size_t i{0}; i<cell_ids.size(); ++i)
+    cell_keys[i] = cell_id_manager.idToKey(cell_ids[i]);
+  toCellKeys(cell_keys, create, std::forward<Function>(f), extrapolation_function);
+}
+
 // Move iterator to a specific cell index path (can also create it with a flag)
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toIndexPath(const std::vector<unsigned> &index_path, const bool create, ExtrapolationFunctionType extrapolation_function) {
-  return this->toCellId(this->indexPathToId(index_path), create, extrapolation_function);
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toIndexPath(const std::vector<unsigned> &index_path, const bool create, ExtrapolationFunctionType extrapolation_function) {
+  return this->toCellKey(cell_id_manager.orderPathToKey(derived().indexToOrderPath(index_path)), create, extrapolation_function);
 }
 
 // Generate an ID from the genealogy of a cell.
-template<typename CellType>
-std::vector<unsigned> AbstractTreeIterator<CellType>::indexPathToId(const std::vector<unsigned> &index_path) const {
-  const std::vector<unsigned> order_path = this->indexToOrderPath(index_path);
+template<typename CellType, typename DerivedIteratorType>
+std::vector<unsigned> AbstractTreeIterator<CellType, DerivedIteratorType>::indexPathToId(const std::vector<unsigned> &index_path) const {
+  const std::vector<unsigned> order_path = derived().indexToOrderPath(index_path);
   return cell_id_manager.orderPathToId(order_path);
 }
 
 // Generate an ID from the genealogy of a cell.
-template<typename CellType>
-std::vector<unsigned> AbstractTreeIterator<CellType>::orderPathToId(const std::vector<unsigned> &order_path) const {
+template<typename CellType, typename DerivedIteratorType>
+std::vector<unsigned> AbstractTreeIterator<CellType, DerivedIteratorType>::orderPathToId(const std::vector<unsigned> &order_path) const {
   return cell_id_manager.orderPathToId(order_path);
 }
 
 // Generate an ID from the genealogy of a cell.
-template<typename CellType>
-std::vector<unsigned> AbstractTreeIterator<CellType>::idToOrderPath(const std::vector<unsigned> &cell_id) const {
+template<typename CellType, typename DerivedIteratorType>
+std::vector<unsigned> AbstractTreeIterator<CellType, DerivedIteratorType>::idToOrderPath(const std::vector<unsigned> &cell_id) const {
   return cell_id_manager.idToOrderPath(cell_id);
 }
 
 // Put iterator to child cell
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toChild(const unsigned order) {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toChild(const unsigned order) {
   order_path.push_back(order);
-  index_path.push_back(this->orderToSiblingNumber(order));
+  index_path.push_back(derived().orderToSiblingNumber(order));
   current_cell = getChildCellFromOrder(current_cell, order);
-  cell_id_manager.toChild(current_cell_id, order);
+  current_cell_key = cell_id_manager.childKey(current_cell_key, order);
   //compareID("toChild: ");
   // Update current cell partition
   int child_partition_size = level_partition_sizes[order_path.size()-1];
@@ -292,12 +369,12 @@ void AbstractTreeIterator<CellType>::toChild(const unsigned order) {
 }
 
 // Put iterator to parent cell
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toParent() {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toParent() {
   order_path.pop_back();
   index_path.pop_back();
   current_cell = current_cell->getParentOct()->getParentCell();
-  cell_id_manager.toParent(current_cell_id);
+  current_cell_key = cell_id_manager.parentKey(current_cell_key);
   //compareID("toParent: ");
   // Update current cell partition
   int parent_partition_size = level_partition_sizes[order_path.size()-1];
@@ -308,14 +385,14 @@ void AbstractTreeIterator<CellType>::toParent() {
 }
 
 // Put iterator to root cell
-template<typename CellType>
-void AbstractTreeIterator<CellType>::toRoot(const unsigned root_number) {
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::toRoot(const unsigned root_number) {
   index_path.clear();
   order_path.clear();
   index_path.push_back(root_number);
   order_path.push_back(root_number);
-  current_cell = root_cells[root_number];
-  cell_id_manager.toRoot(current_cell_id, root_number);
+  current_cell = root_cells[root_number].get();
+  current_cell_key = cell_id_manager.rootKey(root_number);
   //compareID("toRoot: ");
   // Update current cell partition
   current_cell_partition = std::make_pair(
@@ -324,8 +401,22 @@ void AbstractTreeIterator<CellType>::toRoot(const unsigned root_number) {
   );
 }
 
+// Go down from the current cell to the cell of a key (the current cell must be an ancestor)
+template<typename CellType, typename DerivedIteratorType>
+void AbstractTreeIterator<CellType, DerivedIteratorType>::descendToCellKey(const CellKeyType cell_key, const bool create, const ExtrapolationFunctionType &extrapolation_function) {
+  const size_t level = cell_id_manager.getKeyLevel(cell_key);
+  while (order_path.size() <= level) {
+    if (create && current_cell->isLeaf())
+      current_cell->split(max_level, extrapolation_function);
+    if (!current_cell->isLeaf())
+      derived().toChild(cell_id_manager.getKeyOrder(cell_key, order_path.size()));
+    else
+      throw std::runtime_error("Cannot reach cell in AbstractTreeIterator::toCellKey()");
+  }
+}
+
 // Return the child cell from order and mother cell orientation (obtained by following the curve)
-template<typename CellType>
-std::shared_ptr<CellType> AbstractTreeIterator<CellType>::getChildCellFromOrder(std::shared_ptr<CellType> cell, unsigned order, const bool compute_orientation) {
-  return cell->getChildCell(this->orderToSiblingNumber(order, compute_orientation));
+template<typename CellType, typename DerivedIteratorType>
+CellType* AbstractTreeIterator<CellType, DerivedIteratorType>::getChildCellFromOrder(const CellType *cell, unsigned order, const bool compute_orientation) {
+  return cell->getChildCell(derived().orderToSiblingNumber(order, compute_orientation)).get();
 }
@@ -3,7 +3,7 @@
  *  Copyright (c) 2025 Sofiane BOUSABAA
  *  Licensed under the MIT License (see LICENSE file in project root)
  *
- *  Description: Class for iterating through tree cells based on Morton space-filling curves.
+ *  Description: Class for iterating through tree cells based on Hilbert space-filling curves.
  */
 
 #pragma once
@@ -21,32 +21,36 @@
 #include "HilbertTables.h"
 
 template<typename CellType>
-class HilbertIterator : public AbstractTreeIterator<CellType> {
+class HilbertIterator : public AbstractTreeIterator<CellType, HilbertIterator<CellType>> {
+  using BaseType = AbstractTreeIterator<CellType, HilbertIterator<CellType>>;
+  friend BaseType;
+
  public:
   static constexpr std::array<char, 4> CONFIG_SELECTION_NAME{
     'H', '0', '0', '0'
   };
-  using CellIdManagerType = typename AbstractTreeIterator<CellType>::CellIdManagerType;
-  using ExtrapolationFunctionType = typename AbstractTreeIterator<CellType>::ExtrapolationFunctionType;
-  static constexpr unsigned number_of_corners = 1u << CellType::number_split_dimensions;
-  static constexpr unsigned number_of_orientations = CellType::number_split_dimensions * number_of_corners;
+  using CellIdManagerType = typename BaseType::CellIdManagerType;
+  using ExtrapolationFunctionType = typename BaseType::ExtrapolationFunctionType;
+  static constexpr unsigned number_of_corners = HilbertTables<CellType>::number_of_corners;
+  static constexpr unsigned number_of_orientations = HilbertTables<CellType>::number_of_orientations;
 
   //***********************************************************//
   //  DATA                                                     //
   //***********************************************************//
  protected:
-  using AbstractTreeIterator<CellType>::index_path;
+  using BaseType::index_path;
  private:
+  using HilbertTablesType = HilbertTables<CellType>;
   // Possible leaf orientations
-  const std::vector<unsigned> &possible_leaf_orientations;
+  static constexpr const auto &possible_leaf_orientations = HilbertTablesType::possible_leaf_orientations;
   // Map order to sibling number for each mother orientation
-  const std::array<std::array<unsigned, number_of_corners>, number_of_orientations> &child_orderings;
+  static constexpr const auto &child_orderings = HilbertTablesType::child_orderings;
   // Map order to child cell orientation for each mother orientation
-  const std::array<std::array<unsigned, number_of_corners>, number_of_orientations> &child_orientations;
+  static constexpr const auto &child_orientations = HilbertTablesType::child_orientations;
   // Map sibling number to order for each mother orientation
-  const std::array<std::array<unsigned, number_of_corners>, number_of_orientations> &reverse_child_orderings;
+  static constexpr const auto &reverse_child_orderings = HilbertTablesType::reverse_child_orderings;
   // Default leaf orientation
-  const unsigned default_leaf_orientation;
+  static constexpr unsigned default_leaf_orientation = HilbertTablesType::possible_leaf_orientations[0];
   // Root cell orientations
   std::vector<unsigned> root_cell_orientations;
   // Vector of orders
@@ -63,18 +67,28 @@ class HilbertIterator : public AbstractTreeIterator<CellType> {
   //  METHODS                                                  //
   //***********************************************************//
  public:
- protected:
   // Converts the genealogy of a cell
-  std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const override;
+  std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const;
+  // Converts the genealogy of a cell (inverse of indexToOrderPath)
+  std::vector<unsigned> orderToIndexPath(const std::vector<unsigned> &order_path) const;
+  // Curve orientation of a root cell
+  unsigned getRootOrientation(const unsigned root_number) const { return root_cell_orientations[root_number]; };
+  // Curve orientation of the child cell of an order
+  unsigned getChildOrientation(const unsigned orientation, const unsigned order) const { return child_orientations[orientation][order]; };
+  // Sibling number of the child cell of an order
+  unsigned getChildSiblingNumber(const unsigned orientation, const unsigned order) const { return child_orderings[orientation][order]; };
+  // Order of the child cell of a sibling number
+  unsigned getChildOrder(const unsigned orientation, const unsigned sibling_number) const { return reverse_child_orderings[orientation][sibling_number]; };
+ protected:
   // Return the sibling number from the order (number along
   // the curve) with respect to the mother orientation.
-  unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const override;
+  unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const;
   // Go to child cell
-  void toChild(const unsigned order) override;
+  void toChild(const unsigned order);
   // Go to parent cell
-  void toParent() override;
+  void toParent();
   // Go to root cell
-  void toRoot(const unsigned root_number) override;
+  void toRoot(const unsigned root_number);
  private:
   // Next orientation
   unsigned nextOrientation(unsigned order) const;
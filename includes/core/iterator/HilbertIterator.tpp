@@ -7,12 +7,8 @@
 // Constructor
 template <typename CellType>
 HilbertIterator<CellType>::HilbertIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
-: AbstractTreeIterator<CellType>(root_cells, max_level),
-  possible_leaf_orientations(HilbertTables<CellType>::get_possible_leaf_orientations()),
-  child_orderings(HilbertTables<CellType>::get_child_orderings()),
-  child_orientations(HilbertTables<CellType>::get_child_orientations()),
-  reverse_child_orderings(HilbertTables<CellType>::get_reverse_child_orderings()),
-  default_leaf_orientation(possible_leaf_orientations[0]) {
+: BaseType(root_cells, max_level) {
+  HilbertTablesType::checkSupported();
 
   root_cell_orientations = std::vector<unsigned>(root_cells.size(), default_leaf_orientation);
   orientation_path.reserve(max_level+1);
@@ -37,29 +33,41 @@ std::vector<unsigned> HilbertIterator<CellType>::indexToOrderPath(const std::vec
   return order_path;
 }
 
+// Converts the genealogy of a cell (inverse of indexToOrderPath)
+template <typename CellType>
+std::vector<unsigned> HilbertIterator<CellType>::orderToIndexPath(const std::vector<unsigned> &order_path) const {
+  std::vector<unsigned> index_path(order_path.size());
+  index_path[0] = order_path[0];
+  unsigned orientation = root_cell_orientations[order_path[0]];
+  for (size_t i{1}; i<order_path.size(); ++i) {
+    index_path[i] = child_orderings[orientation][order_path[i]];
+    orientation = child_orientations[orientation][order_path[i]];
+  }
+  return index_path;
+}
+
 // Return the sibling number from the order (number along
 // the curve) with respect to the mother orientation.
-// For Mortong Z curve sibling_number = order
+// The Hilbert tables are indexed by the mother orientation,
+// which is the last one of the path in both cases.
 template <typename CellType>
-unsigned HilbertIterator<CellType>::orderToSiblingNumber(unsigned order, const bool compute_orientation) const {
-  if (compute_orientation)
-    return child_orderings[nextOrientation(order)][order];
-  else
-    return child_orderings[orientation_path.back()][order];
+unsigned HilbertIterator<CellType>::orderToSiblingNumber(unsigned order, const bool) const {
+  return child_orderings[orientation_path.back()][order];
 }
 
-// Go to child cell
+// Go to child cell (the mother orientation is used to find the child)
 template <typename CellType>
 void HilbertIterator<CellType>::toChild(const unsigned order) {
-  orientation_path.push_back(nextOrientation(order));
-  AbstractTreeIterator<CellType>::toChild(order);
+  const unsigned orientation = nextOrientation(order);
+  BaseType::toChild(order);
+  orientation_path.push_back(orientation);
 }
 
 // Go to parent cell
 template <typename CellType>
 void HilbertIterator<CellType>::toParent() {
   orientation_path.pop_back();
-  AbstractTreeIterator<CellType>::toParent();
+  BaseType::toParent();
 }
 
 // Go to parent cell
@@ -67,7 +75,7 @@ template <typename CellType>
 void HilbertIterator<CellType>::toRoot(const unsigned root_number) {
   orientation_path.clear();
   orientation_path.push_back(root_cell_orientations[root_number]);
-  AbstractTreeIterator<CellType>::toRoot(root_number);
+  BaseType::toRoot(root_number);
 }
 
 // Next orientation
@@ -0,0 +1,36 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Block of N consecutive owned leaf cells along the space-filling curve for vectorized kernels.
+ *
+ *  The owned leaf positions of a batch are consecutive (indices[i] == first_index + i) so the fields of the registry can
+ *  be loaded and stored as contiguous blocks. Only the last batch of a sweep may hold less than N leaves: its remaining
+ *  lanes repeat the last valid leaf so that full width gathers stay valid, and results must only be stored for the first
+ *  size lanes.
+ */
+
+#pragma once
+
+#include <array>
+
+template<typename CellType, unsigned N>
+struct LeafBatch {
+  static_assert(N > 0, "LeafBatch needs at least one lane");
+  static constexpr unsigned capacity = N;
+
+  // Leaf cells
+  std::array<CellType*, N> cells;
+  // Levels of the leaf cells
+  std::array<unsigned char, N> levels;
+  // Owned leaf positions of the leaf cells
+  std::array<unsigned, N> indices;
+  // Owned leaf position of the first leaf cell
+  unsigned first_index;
+  // Number of valid lanes (N except for the tail batch)
+  unsigned size;
+
+  // Check if all the lanes are valid
+  bool full() const { return size == N; };
+};
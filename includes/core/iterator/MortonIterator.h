@@ -20,7 +20,10 @@
 #include "MortonTables.h"
 
 template<typename CellType, short MORTON_ORIENTATION = 123>
-class MortonIterator : public AbstractTreeIterator<CellType> {
+class MortonIterator : public AbstractTreeIterator<CellType, MortonIterator<CellType, MORTON_ORIENTATION>> {
+  using BaseType = AbstractTreeIterator<CellType, MortonIterator<CellType, MORTON_ORIENTATION>>;
+  friend BaseType;
+
  public:
   static constexpr std::array<char, 4> CONFIG_SELECTION_NAME{
     'M',
@@ -28,17 +31,19 @@ class MortonIterator : public AbstractTreeIterator<CellType> {
     char('0' + (MORTON_ORIENTATION / 10) % 10),
     char('0' + MORTON_ORIENTATION % 10)
   };
-  using CellIdManagerType = typename AbstractTreeIterator<CellType>::CellIdManagerType;
-  using ExtrapolationFunctionType = typename AbstractTreeIterator<CellType>::ExtrapolationFunctionType;
+  using CellIdManagerType = typename BaseType::CellIdManagerType;
+  using ExtrapolationFunctionType = typename BaseType::ExtrapolationFunctionType;
+  // Number of curve orientations of a cell (the Morton curve has the same orientation everywhere)
+  static constexpr unsigned number_of_orientations = 1;
 
   //***********************************************************//
   //  DATA                                                     //
   //***********************************************************//
  private:
   // Map order to sibling number for each mother orientation
-  const std::array<unsigned, CellType::number_children> &order_to_sibling_number;
+  static constexpr const auto &order_to_sibling_number = MortonTables<CellType, MORTON_ORIENTATION>::orderings;
   // Map sibling number to order for each mother orientation
-  const std::array<unsigned, CellType::number_children> &sibling_number_to_order;
+  static constexpr const auto &sibling_number_to_order = MortonTables<CellType, MORTON_ORIENTATION>::reverse_child_orderings;
 
   //***********************************************************//
   //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
@@ -51,12 +56,22 @@ class MortonIterator : public AbstractTreeIterator<CellType> {
   //  METHODS                                                  //
   //***********************************************************//
  public:
- protected:
   // Converts the genealogy of a cell
-  std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const override;
+  std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const;
+  // Converts the genealogy of a cell (inverse of indexToOrderPath)
+  std::vector<unsigned> orderToIndexPath(const std::vector<unsigned> &order_path) const;
+  // Curve orientation of a root cell
+  unsigned getRootOrientation(const unsigned root_number) const { (void)root_number; return 0; };
+  // Curve orientation of the child cell of an order
+  unsigned getChildOrientation(const unsigned orientation, const unsigned order) const { (void)orientation; (void)order; return 0; };
+  // Sibling number of the child cell of an order
+  unsigned getChildSiblingNumber(const unsigned orientation, const unsigned order) const { (void)orientation; return order_to_sibling_number[order]; };
+  // Order of the child cell of a sibling number
+  unsigned getChildOrder(const unsigned orientation, const unsigned sibling_number) const { (void)orientation; return sibling_number_to_order[sibling_number]; };
+ protected:
   // Return the sibling number from the order (number along
   // the curve) with respect to the mother orientation.
-  unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const override;
+  unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const;
 };
 
 #include "MortonIterator.tpp"
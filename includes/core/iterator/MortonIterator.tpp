@@ -7,9 +7,7 @@
 // Constructor
 template<typename CellType, short MORTON_ORIENTATION>
 MortonIterator<CellType, MORTON_ORIENTATION>::MortonIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
-: AbstractTreeIterator<CellType>(root_cells, max_level),
-  order_to_sibling_number(MortonTables<CellType, MORTON_ORIENTATION>::get_orderings()),
-  sibling_number_to_order(MortonTables<CellType, MORTON_ORIENTATION>::get_reverse_orderings()) {};
+: BaseType(root_cells, max_level) {};
 
 //***********************************************************//
 //  METHODS                                                  //
@@ -25,6 +23,16 @@ std::vector<unsigned> MortonIterator<CellType, MORTON_ORIENTATION>::indexToOrder
   return order_path;
 }
 
+// Converts the genealogy of a cell (inverse of indexToOrderPath)
+template<typename CellType, short MORTON_ORIENTATION>
+std::vector<unsigned> MortonIterator<CellType, MORTON_ORIENTATION>::orderToIndexPath(const std::vector<unsigned> &order_path) const {
+  std::vector<unsigned> index_path(order_path.size());
+  index_path[0] = order_path[0];
+  for (size_t i{1}; i<order_path.size(); ++i)
+    index_path[i] = order_to_sibling_number[order_path[i]];
+  return index_path;
+}
+
 // Return the sibling number from the order (number along
 // the curve) with respect to the mother orientation.
 // For Mortong Z curve sibling_number = order
@@ -3,12 +3,13 @@
  *  Copyright (c) 2025 Sofiane BOUSABAA
  *  Licensed under the MIT License (see LICENSE file in project root)
  *
- *  Description: Class for computing and providing Morton iterator ordering tables.
- *  Avoids recomputing tables at each instanciation of iterator.
+ *  Description: Class providing Morton iterator ordering tables.
+ *  Tables are generated at compile time (no initialization guard or heap indirection on lookups).
  */
 
 #pragma once
 
+#include<algorithm>
 #include<array>
 
 //***********************************************************//
@@ -19,7 +20,7 @@ template<typename CellType, short MORTON_ORIENTATION>
 constexpr std::array<unsigned, CellType::number_children> make_orderings();
 
 template<size_t ARRAY_SIZE>
-std::array<unsigned, ARRAY_SIZE> reverse_orderings(const std::array<unsigned, ARRAY_SIZE> &orderings);
+constexpr std::array<unsigned, ARRAY_SIZE> reverse_orderings(const std::array<unsigned, ARRAY_SIZE> &orderings);
 
 
 //***********************************************************//
@@ -28,8 +29,8 @@ std::array<unsigned, ARRAY_SIZE> reverse_orderings(const std::array<unsigned, AR
 
 template<class CellType, short MORTON_ORIENTATION>
 struct MortonTables {
-  static const auto& get_orderings()         { static const auto t = make_orderings<CellType, MORTON_ORIENTATION>(); return t; }
-  static const auto& get_reverse_orderings() { static const auto t = reverse_orderings<CellType::number_children>(get_orderings()); return t; }
+  static constexpr std::array<unsigned, CellType::number_children> orderings = make_orderings<CellType, MORTON_ORIENTATION>();
+  static constexpr std::array<unsigned, CellType::number_children> reverse_child_orderings = reverse_orderings<CellType::number_children>(orderings);
 };
 
 
@@ -78,8 +79,8 @@ constexpr std::array<unsigned, CellType::number_children> make_orderings() {
 }
 
 template<size_t ARRAY_SIZE>
-std::array<unsigned, ARRAY_SIZE> reverse_orderings(const std::array<unsigned, ARRAY_SIZE> &orderings) {
-  std::array<unsigned, ARRAY_SIZE> reverse_orderings;
+constexpr std::array<unsigned, ARRAY_SIZE> reverse_orderings(const std::array<unsigned, ARRAY_SIZE> &orderings) {
+  std::array<unsigned, ARRAY_SIZE> reverse_orderings{};
   for (unsigned i{0}; i<ARRAY_SIZE; ++i)
     reverse_orderings[orderings[i]] = i;
   return reverse_orderings;
@@ -0,0 +1,70 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Range of the neighbor leaf cells of a cell (gathered once in a fixed-size array) to be used in range-for
+ *  loops so that the loop body is inlined in the user kernel.
+ */
+
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+template<typename CellType>
+class NeighborLeafRange {
+ public:
+  using ChildAndDirectionTablesType = typename CellType::ChildAndDirectionTablesType;
+  // Maximum number of neighbor leaf cells (2:1 balanced mesh)
+  static constexpr unsigned max_number_neighbors = ChildAndDirectionTablesType::max_number_neighbor_leaf_cells;
+  // Neighbor leaf cell and direction from the cell
+  struct NeighborLeaf {
+    CellType *cell;
+    unsigned dir;
+  };
+  using const_iterator = typename std::array<NeighborLeaf, max_number_neighbors>::const_iterator;
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Neighbor leaf cells
+  std::array<NeighborLeaf, max_number_neighbors> neighbors;
+  // Number of neighbor leaf cells
+  unsigned number_neighbors;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor (null neighbors are skipped, any range of directions)
+  template<typename DirectionsType>
+  NeighborLeafRange(const CellType &cell, const DirectionsType &directions);
+  // Destructor
+  ~NeighborLeafRange() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the number of neighbor leaf cells
+  unsigned size() const { return number_neighbors; };
+  // Check if there is no neighbor leaf cell
+  bool empty() const { return number_neighbors == 0; };
+  // Get a neighbor leaf cell
+  const NeighborLeaf& operator[](const unsigned i) const { return neighbors[i]; };
+  // Iterators on the neighbor leaf cells
+  const_iterator begin() const { return neighbors.begin(); };
+  const_iterator end() const { return neighbors.begin() + number_neighbors; };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ private:
+  // Add a neighbor leaf cell
+  void add(CellType *cell, const unsigned dir);
+};
+
+#include "NeighborLeafRange.tpp"
@@ -0,0 +1,47 @@
+#include "NeighborLeafRange.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor (null neighbors are skipped, any range of directions)
+template<typename CellType>
+template<typename DirectionsType>
+NeighborLeafRange<CellType>::NeighborLeafRange(const CellType &cell, const DirectionsType &directions)
+: number_neighbors(0) {
+  // If a neighbor is used more than once in the process it can be retrived from this array
+  std::array<CellType*, CellType::number_plane_neighbors> cached_neighbors;
+  cached_neighbors.fill(const_cast<CellType*>(&cell));
+
+  for (const unsigned dir : directions) {
+    CellType *neighbor = cell.getNeighborCellAndSave(dir, &cached_neighbors);
+
+    // No neighbor cell in this direction
+    if (!neighbor)
+      continue;
+
+    // The neighbor leaf cell has the same level or is coarser
+    if (neighbor->isLeaf()) {
+      add(neighbor, dir);
+      continue;
+    }
+
+    // The neighbor cell is higher level so we add its children
+    const auto &neighbor_child_cells = neighbor->getChildCells();
+    for (const unsigned sibling_number : ChildAndDirectionTablesType::dir_sibling_numbers[dir])
+      add(neighbor_child_cells[sibling_number].get(), dir);
+  }
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Add a neighbor leaf cell
+template<typename CellType>
+void NeighborLeafRange<CellType>::add(CellType *cell, const unsigned dir) {
+  if (number_neighbors == max_number_neighbors)
+    throw std::runtime_error("Too many neighbor leaf cells (repeated directions) in NeighborLeafRange::add()");
+  neighbors[number_neighbors++] = NeighborLeaf{cell, dir};
+}
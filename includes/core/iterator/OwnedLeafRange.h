@@ -0,0 +1,80 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Range of the owned leaf cells of a tree along the space-filling curve (driven by the key leaf iterator)
+ *  to be used in range-for loops so that the loop body is inlined in the user kernel.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "SfcLeafIterator.h"
+
+template<typename CellType, typename TreeIteratorType>
+class OwnedLeafRange {
+ public:
+  using SfcLeafIteratorType = SfcLeafIterator<CellType, TreeIteratorType>;
+
+  // Single pass iterator on the owned leaf cells (all the copies share the leaf iterator of the range)
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = CellType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = CellType*;
+    using reference = CellType&;
+
+   private:
+    // Leaf iterator of the range
+    SfcLeafIteratorType *leaf_iterator;
+    // False once past the last owned leaf cell
+    bool valid;
+
+   public:
+    Iterator(SfcLeafIteratorType *leaf_iterator, const bool valid) : leaf_iterator(leaf_iterator), valid(valid) {};
+    // Get the current cell
+    CellType& operator*() const { return *leaf_iterator->getCellPtr(); };
+    CellType* operator->() const { return leaf_iterator->getCellPtr(); };
+    // Go to the next owned leaf cell
+    Iterator& operator++() { valid = leaf_iterator->ownedNext(); return *this; };
+    // Only the end of the range is compared
+    bool operator==(const Iterator &other) const { return valid == other.valid; };
+    bool operator!=(const Iterator &other) const { return valid != other.valid; };
+    // Get the key leaf iterator (key, level and smart pointer of the current cell)
+    const SfcLeafIteratorType& getLeafIterator() const { return *leaf_iterator; };
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Key leaf iterator
+  SfcLeafIteratorType leaf_iterator;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor
+  OwnedLeafRange(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level) : leaf_iterator(root_cells, max_level) {};
+  // Constructor from the range of the root cells belonging to this process
+  OwnedLeafRange(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level, const std::pair<unsigned, unsigned> &owned_roots) : leaf_iterator(root_cells, max_level) { leaf_iterator.setOwnedRoots(owned_roots); };
+  // Destructor
+  ~OwnedLeafRange() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Iterator on the first owned leaf cell (restarts the range)
+  Iterator begin() { return Iterator(&leaf_iterator, leaf_iterator.toOwnedBegin()); };
+  // Iterator past the last owned leaf cell
+  Iterator end() { return Iterator(&leaf_iterator, false); };
+};
@@ -0,0 +1,87 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Class for iterating through tree cells based on Peano space-filling curves (3-way splitting).
+ */
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../manager/CellIdManager.h"
+#include "AbstractTreeIterator.h"
+#include "PeanoTables.h"
+
+template<typename CellType>
+class PeanoIterator : public AbstractTreeIterator<CellType, PeanoIterator<CellType>> {
+  using BaseType = AbstractTreeIterator<CellType, PeanoIterator<CellType>>;
+  friend BaseType;
+
+ public:
+  static constexpr std::array<char, 4> CONFIG_SELECTION_NAME{
+    'P', '0', '0', '0'
+  };
+  using CellIdManagerType = typename BaseType::CellIdManagerType;
+  using ExtrapolationFunctionType = typename BaseType::ExtrapolationFunctionType;
+  static constexpr unsigned number_of_orientations = PeanoTables<CellType>::number_of_orientations;
+
+  //***********************************************************//
+  //  DATA                                                     //
+  //***********************************************************//
+ protected:
+  using BaseType::index_path;
+ private:
+  using PeanoTablesType = PeanoTables<CellType>;
+  // Map order to sibling number for each mother orientation
+  static constexpr const auto &child_orderings = PeanoTablesType::child_orderings;
+  // Map order to child cell orientation for each mother orientation
+  static constexpr const auto &child_orientations = PeanoTablesType::child_orientations;
+  // Map sibling number to order for each mother orientation
+  static constexpr const auto &reverse_child_orderings = PeanoTablesType::reverse_child_orderings;
+  // Root cell orientations
+  std::vector<unsigned> root_cell_orientations;
+  // Vector of orientations
+  std::vector<unsigned> orientation_path;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor
+  PeanoIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level);
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Converts the genealogy of a cell
+  std::vector<unsigned> indexToOrderPath(const std::vector<unsigned> &index_path) const;
+  // Converts the genealogy of a cell (inverse of indexToOrderPath)
+  std::vector<unsigned> orderToIndexPath(const std::vector<unsigned> &order_path) const;
+  // Curve orientation of a root cell
+  unsigned getRootOrientation(const unsigned root_number) const { return root_cell_orientations[root_number]; };
+  // Curve orientation of the child cell of an order
+  unsigned getChildOrientation(const unsigned orientation, const unsigned order) const { return child_orientations[orientation][order]; };
+  // Sibling number of the child cell of an order
+  unsigned getChildSiblingNumber(const unsigned orientation, const unsigned order) const { return child_orderings[orientation][order]; };
+  // Order of the child cell of a sibling number
+  unsigned getChildOrder(const unsigned orientation, const unsigned sibling_number) const { return reverse_child_orderings[orientation][sibling_number]; };
+ protected:
+  // Return the sibling number from the order (number along
+  // the curve) with respect to the mother orientation.
+  unsigned orderToSiblingNumber(unsigned order, const bool compute_orientation=false) const;
+  // Go to child cell
+  void toChild(const unsigned order);
+  // Go to parent cell
+  void toParent();
+  // Go to root cell
+  void toRoot(const unsigned root_number);
+};
+
+#include "PeanoIterator.tpp"
@@ -0,0 +1,79 @@
+#include "PeanoIterator.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor
+template <typename CellType>
+PeanoIterator<CellType>::PeanoIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
+: BaseType(root_cells, max_level) {
+  PeanoTablesType::checkSupported();
+
+  root_cell_orientations = std::vector<unsigned>(root_cells.size(), 0);
+  orientation_path.reserve(max_level+1);
+  orientation_path.resize(1);
+  orientation_path[0] = root_cell_orientations[index_path[0]];
+};
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Converts the genealogy of a cell
+template <typename CellType>
+std::vector<unsigned> PeanoIterator<CellType>::indexToOrderPath(const std::vector<unsigned> &index_path) const {
+  std::vector<unsigned> order_path(index_path.size());
+  order_path[0] = index_path[0];
+  unsigned orientation = root_cell_orientations[index_path[0]];
+  for (size_t i{1}; i<index_path.size(); ++i) {
+    order_path[i] = reverse_child_orderings[orientation][index_path[i]];
+    orientation = child_orientations[orientation][order_path[i]];
+  }
+  return order_path;
+}
+
+// Converts the genealogy of a cell (inverse of indexToOrderPath)
+template <typename CellType>
+std::vector<unsigned> PeanoIterator<CellType>::orderToIndexPath(const std::vector<unsigned> &order_path) const {
+  std::vector<unsigned> index_path(order_path.size());
+  index_path[0] = order_path[0];
+  unsigned orientation = root_cell_orientations[order_path[0]];
+  for (size_t i{1}; i<order_path.size(); ++i) {
+    index_path[i] = child_orderings[orientation][order_path[i]];
+    orientation = child_orientations[orientation][order_path[i]];
+  }
+  return index_path;
+}
+
+// Return the sibling number from the order (number along
+// the curve) with respect to the mother orientation.
+// The Peano tables are indexed by the mother orientation,
+// which is the last one of the path in both cases.
+template <typename CellType>
+unsigned PeanoIterator<CellType>::orderToSiblingNumber(unsigned order, const bool) const {
+  return child_orderings[orientation_path.back()][order];
+}
+
+// Go to child cell (the mother orientation is used to find the child)
+template <typename CellType>
+void PeanoIterator<CellType>::toChild(const unsigned order) {
+  const unsigned orientation = child_orientations[orientation_path.back()][order];
+  BaseType::toChild(order);
+  orientation_path.push_back(orientation);
+}
+
+// Go to parent cell
+template <typename CellType>
+void PeanoIterator<CellType>::toParent() {
+  orientation_path.pop_back();
+  BaseType::toParent();
+}
+
+// Go to root cell
+template <typename CellType>
+void PeanoIterator<CellType>::toRoot(const unsigned root_number) {
+  orientation_path.clear();
+  orientation_path.push_back(root_cell_orientations[root_number]);
+  BaseType::toRoot(root_number);
+}
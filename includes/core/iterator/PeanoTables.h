@@ -0,0 +1,133 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Class providing Peano iterator ordering tables.
+ *  Tables are generated at compile time (no initialization guard or heap indirection on lookups).
+ */
+
+#pragma once
+
+#include<array>
+#include<stdexcept>
+#include<string>
+
+//***********************************************************//
+//  PROTOTYPES.                                              //
+//***********************************************************//
+
+template<typename CellType>
+constexpr bool peano_splitting_is_supported();
+
+template<typename CellType, unsigned NUMBER_ORIENTATIONS>
+constexpr std::array<std::array<unsigned, CellType::number_children>, NUMBER_ORIENTATIONS> compute_peano_child_tables(const bool orientations);
+
+template<unsigned NUMBER_CHILDREN, unsigned NUMBER_ORIENTATIONS>
+constexpr std::array<std::array<unsigned, NUMBER_CHILDREN>, NUMBER_ORIENTATIONS> reverse_peano_orderings(const std::array<std::array<unsigned, NUMBER_CHILDREN>, NUMBER_ORIENTATIONS> &orderings);
+
+
+//***********************************************************//
+//  MAIN CLASS                                               //
+//***********************************************************//
+
+template<class CellType>
+struct PeanoTables {
+  // An orientation is the set of axes along which the curve is mirrored (one bit per axis)
+  static constexpr unsigned number_of_orientations = 1u << CellType::number_dimensions;
+  using OrderingsType = std::array<std::array<unsigned, CellType::number_children>, number_of_orientations>;
+
+  // Splitting handled by the curve (the tables are zero filled otherwise)
+  static constexpr bool is_supported = peano_splitting_is_supported<CellType>();
+  static constexpr OrderingsType child_orderings = compute_peano_child_tables<CellType, number_of_orientations>(false);
+  static constexpr OrderingsType child_orientations = compute_peano_child_tables<CellType, number_of_orientations>(true);
+  static constexpr OrderingsType reverse_child_orderings = reverse_peano_orderings<CellType::number_children, number_of_orientations>(child_orderings);
+
+  // Throw if the splitting is not handled by the curve
+  static void checkSupported() {
+    if (!is_supported)
+      throw std::runtime_error(
+        "PeanoIterator does not handle cell splitting "
+        + ("(" + std::to_string(CellType::Nx) + ", " + std::to_string(CellType::Ny) + ", " + std::to_string(CellType::Nz) + "). ") +
+        "Only odd numbers of children per direction are supported (e.g. 3x3 or 3x3x3). "
+        "Consider using HilbertIterator for 2-way splitting."
+      );
+  }
+};
+
+
+//***********************************************************//
+//  IMPLEMEBNTATIONS                                         //
+//***********************************************************//
+
+template<typename CellType>
+constexpr bool peano_splitting_is_supported() {
+  return (CellType::Nx < 2 || CellType::Nx%2 == 1) && (CellType::Ny < 2 || CellType::Ny%2 == 1) && (CellType::Nz < 2 || CellType::Nz%2 == 1);
+}
+
+// Creation of tables needed for ordering in 2D (3x3 splitting):
+// Numerotation of child cells (cell index) and curve of orientation O0 (no mirroring):
+//
+//      C6 ── C7 ── C8
+//       │
+//      C5 ── C4 ── C3         O0 : C0 -> C8
+//                   │         O1 : C2 -> C6 (mirrored along x)
+//      C0 ── C1 ── C2         O2 : C6 -> C2 (mirrored along y)
+//                             O3 : C8 -> C0 (mirrored along x and y)
+//
+// The children are visited in serpentine order (x fastest, an axis is swept backwards when the sum of the coordinates
+// along the slower axes is odd). The child curve is mirrored along an axis when the sum of its coordinates along the
+// other axes is odd, so that it leaves the child cell where the next one starts. The same rules hold in 3D with any odd
+// number of children per direction.
+template<typename CellType, unsigned NUMBER_ORIENTATIONS>
+constexpr std::array<std::array<unsigned, CellType::number_children>, NUMBER_ORIENTATIONS> compute_peano_child_tables(const bool orientations) {
+  std::array<std::array<unsigned, CellType::number_children>, NUMBER_ORIENTATIONS> child_orderings{}, child_orientations{};
+  if (!peano_splitting_is_supported<CellType>())
+    return child_orderings;
+
+  const std::array<unsigned, 3> N{
+    static_cast<unsigned>(CellType::Nx > 1 ? CellType::Nx : 1),
+    static_cast<unsigned>(CellType::Ny > 1 ? CellType::Ny : 1),
+    static_cast<unsigned>(CellType::Nz > 1 ? CellType::Nz : 1)
+  };
+  for (unsigned order{0}; order<CellType::number_children; ++order) {
+    // Coordinates of the child along the serpentine
+    std::array<unsigned, 3> digits{}, coords{};
+    unsigned rest = order;
+    for (unsigned d{0}; d<3; ++d) {
+      digits[d] = rest % N[d];
+      rest /= N[d];
+    }
+    unsigned slower_sum{0};
+    for (unsigned d = 3; d-->0; ) {
+      coords[d] = slower_sum%2 == 0 ? digits[d] : N[d]-1-digits[d];
+      slower_sum += coords[d];
+    }
+    // Axes along which the child curve is mirrored
+    unsigned mirror{0};
+    for (unsigned d{0}; d<3; ++d)
+      if (N[d] > 1 && (slower_sum - coords[d])%2 == 1)
+        mirror |= 1u << d;
+
+    for (unsigned orientation{0}; orientation<NUMBER_ORIENTATIONS; ++orientation) {
+      std::array<unsigned, 3> mirrored_coords = coords;
+      for (unsigned d{0}; d<3; ++d)
+        if (orientation & (1u << d))
+          mirrored_coords[d] = N[d]-1-coords[d];
+      child_orderings[orientation][order] = mirrored_coords[0] + N[0]*(mirrored_coords[1] + N[1]*mirrored_coords[2]);
+      child_orientations[orientation][order] = orientation ^ mirror;
+    }
+  }
+
+  return orientations ? child_orientations : child_orderings;
+}
+
+template<unsigned NUMBER_CHILDREN, unsigned NUMBER_ORIENTATIONS>
+constexpr std::array<std::array<unsigned, NUMBER_CHILDREN>, NUMBER_ORIENTATIONS> reverse_peano_orderings(const std::array<std::array<unsigned, NUMBER_CHILDREN>, NUMBER_ORIENTATIONS> &orderings) {
+  std::array<std::array<unsigned, NUMBER_CHILDREN>, NUMBER_ORIENTATIONS> reverse_orderings{};
+  for (unsigned i{0}; i<NUMBER_ORIENTATIONS; ++i) {
+    for (unsigned j{0}; j<NUMBER_CHILDREN; ++j)
+      reverse_orderings[i][orderings[i][j]] = j;
+  }
+  return reverse_orderings;
+}
@@ -0,0 +1,137 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Leaf iterator following the space-filling curve of a tree iterator with the packed cell key and a
+ *  fixed-depth array of cell pointers (no path vectors, virtual calls or recursion while moving).
+ */
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../manager/CellIdManager.h"
+#include "owned_root_range.h"
+
+template<typename CellType, typename TreeIteratorType>
+class SfcLeafIterator {
+ public:
+  using CellIdManagerType = CellIdManager<CellType>;
+  using CellKeyType = typename CellIdManagerType::CellKeyType;
+  static constexpr unsigned number_children = CellType::number_children;
+  static constexpr unsigned number_of_orientations = TreeIteratorType::number_of_orientations;
+  // Deepest level reachable by the iterator
+  static constexpr unsigned max_depth = 64;
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Root cells
+  const std::vector<std::shared_ptr<CellType>> root_cells;
+  // Tree max level
+  const unsigned max_level;
+  // Cell ID manager (packed key arithmetic)
+  CellIdManagerType cell_id_manager;
+  // Position of the order digit of each level in the key, key increment of one order at each level and mask of a digit
+  std::array<unsigned, max_depth+1> key_order_shifts;
+  std::array<CellKeyType, max_depth+1> key_order_units;
+  CellKeyType key_order_mask;
+  // Curve orientation of the root cells
+  std::vector<unsigned char> root_orientations;
+  // Sibling number and curve orientation of the child of an order for each mother orientation
+  std::array<std::array<unsigned char, number_children>, number_of_orientations> child_sibling_numbers, child_orientations;
+  // Cells from the root to the current cell (non-owning)
+  std::array<CellType*, max_depth+1> cells;
+  // Child cells of the parent of each cell from the root to the current cell
+  std::array<const std::shared_ptr<CellType>*, max_depth+1> sibling_cells;
+  // Curve orientations from the root to the current cell
+  std::array<unsigned, max_depth+1> orientations;
+  // Packed key of the current cell
+  CellKeyType current_cell_key;
+  // Level of the current cell
+  unsigned level;
+  // Root index of the current cell
+  unsigned root_number;
+  // Range of the root cells belonging to this process (guess checked in constant time)
+  std::pair<unsigned, unsigned> owned_roots;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor
+  SfcLeafIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level);
+  // Destructor
+  ~SfcLeafIterator() = default;
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get current cell (as a smart pointer for callbacks taking shared_ptr)
+  const std::shared_ptr<CellType>& getCell() const;
+  // Get current cell
+  CellType* getCellPtr() const { return cells[level]; };
+  // Get current cell key
+  CellKeyType getCellKey() const { return current_cell_key; };
+  // Get current cell level
+  unsigned getLevel() const { return level; };
+  // Get current index path (built on demand)
+  std::vector<unsigned> getIndexPath() const;
+  // Get current order path (built on demand)
+  std::vector<unsigned> getOrderPath() const;
+
+  //***********************************************************//
+  //  MUTATORS                                                 //
+  //***********************************************************//
+ public:
+  // Set the range of the root cells belonging to this process (avoids scanning the roots)
+  void setOwnedRoots(const std::pair<unsigned, unsigned> &owned_roots) { this->owned_roots = owned_roots; };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Go to the next leaf cell
+  bool next(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the next leaf cell belonging to this proc
+  bool ownedNext(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the previous leaf cell
+  bool prev(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the previous leaf cell belonging to this proc
+  bool ownedPrev(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the first leaf cell of first root
+  void toBegin(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the first leaf cell of first root belonging to this process
+  bool toOwnedBegin(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the last leaf cell of last root
+  void toEnd(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Go to the last leaf cell of last root belonging to this process
+  bool toOwnedEnd(const unsigned sweep_level = std::numeric_limits<int>::max());
+  // Moves the iterator to the cell of a key (false if a leaf cell is met above the key level)
+  bool toCellKey(const CellKeyType cell_key);
+  // Moves the iterator to a leaf cell of the current cell
+  void toLeaf(const unsigned sweep_level = std::numeric_limits<int>::max(), const bool reverse = false);
+  // Moves the iterator to a leaf cell of the current cell that belong to the process
+  void toOwnedLeaf(const unsigned sweep_level = std::numeric_limits<int>::max(), const bool reverse = false);
+ private:
+  // Order of the current cell
+  unsigned getOrder() const { return static_cast<unsigned>((current_cell_key >> key_order_shifts[level]) & key_order_mask); };
+  // Go to child cell
+  void toChild(const unsigned order);
+  // Go to the next (or previous) sibling cell of an order
+  void toSibling(const unsigned order, const bool reverse);
+  // Go to parent cell
+  void toParent();
+  // Go to root cell
+  void toRoot(const unsigned root_number);
+};
+
+#include "SfcLeafIterator.tpp"
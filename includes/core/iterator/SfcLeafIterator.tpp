@@ -0,0 +1,244 @@
+#include "SfcLeafIterator.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor
+template<typename CellType, typename TreeIteratorType>
+SfcLeafIterator<CellType, TreeIteratorType>::SfcLeafIterator(const std::vector<std::shared_ptr<CellType>> &root_cells, const unsigned max_level)
+: root_cells(root_cells),
+  max_level(max_level),
+  cell_id_manager(root_cells.size(), max_level),
+  key_order_shifts{},
+  key_order_units{},
+  key_order_mask(0),
+  cells{},
+  sibling_cells{},
+  orientations{},
+  current_cell_key(0),
+  level(0),
+  root_number(0),
+  owned_roots(0, root_cells.size()) {
+  if (max_level > max_depth)
+    throw std::runtime_error("Max level deeper than the iterator depth in SfcLeafIterator::SfcLeafIterator()");
+
+  // Key layout
+  for (unsigned l{0}; l<=max_level; ++l) {
+    key_order_shifts[l] = cell_id_manager.keyOrderShift(l);
+    key_order_units[l] = CellKeyType(1) << key_order_shifts[l];
+  }
+  if (max_level > 0)
+    key_order_mask = (CellKeyType(1) << (key_order_shifts[0] - key_order_shifts[1])) - 1;
+
+  // Curve tables of the tree iterator
+  const TreeIteratorType curve(root_cells, max_level);
+  root_orientations.resize(root_cells.size());
+  for (unsigned i{0}; i<root_cells.size(); ++i)
+    root_orientations[i] = curve.getRootOrientation(i);
+  for (unsigned orientation{0}; orientation<number_of_orientations; ++orientation)
+    for (unsigned order{0}; order<number_children; ++order) {
+      child_sibling_numbers[orientation][order] = curve.getChildSiblingNumber(orientation, order);
+      child_orientations[orientation][order] = curve.getChildOrientation(orientation, order);
+    }
+}
+
+
+//***********************************************************//
+//  ACCESSORS                                                //
+//***********************************************************//
+
+// Get current cell (as a smart pointer for callbacks taking shared_ptr)
+template<typename CellType, typename TreeIteratorType>
+const std::shared_ptr<CellType>& SfcLeafIterator<CellType, TreeIteratorType>::getCell() const {
+  if (level == 0)
+    return root_cells[root_number];
+  return cells[level]->getParentOct()->getChildCells()[cells[level]->getSiblingNumber()];
+}
+
+// Get current index path (built on demand)
+template<typename CellType, typename TreeIteratorType>
+std::vector<unsigned> SfcLeafIterator<CellType, TreeIteratorType>::getIndexPath() const {
+  std::vector<unsigned> index_path(level+1);
+  index_path[0] = root_number;
+  for (unsigned l{1}; l<=level; ++l)
+    index_path[l] = cells[l]->getSiblingNumber();
+  return index_path;
+}
+
+// Get current order path (built on demand)
+template<typename CellType, typename TreeIteratorType>
+std::vector<unsigned> SfcLeafIterator<CellType, TreeIteratorType>::getOrderPath() const {
+  return cell_id_manager.keyToOrderPath(current_cell_key);
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Go to the next leaf cell
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::next(const unsigned sweep_level) {
+  // Climb until a next sibling exists
+  while (level > 0) {
+    const unsigned order = getOrder();
+    if (order < number_children-1) {
+      toSibling(order+1, false);
+      if (!cells[level]->isLeaf())
+        toLeaf(sweep_level, false);
+      return true;
+    }
+    toParent();
+  }
+  // Next root cell
+  toRoot((root_number+1) % root_cells.size());
+  toLeaf(sweep_level, false);
+  return root_number != 0;
+}
+
+// Go to the next leaf cell belonging to this proc
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::ownedNext(const unsigned sweep_level) {
+  const bool not_loop = next(sweep_level);
+  return not_loop && cells[level]->belongToThisProc();
+}
+
+// Go to the previous leaf cell
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::prev(const unsigned sweep_level) {
+  // Climb until a previous sibling exists
+  while (level > 0) {
+    const unsigned order = getOrder();
+    if (order > 0) {
+      toSibling(order-1, true);
+      if (!cells[level]->isLeaf())
+        toLeaf(sweep_level, true);
+      return true;
+    }
+    toParent();
+  }
+  // Previous root cell
+  toRoot((root_number+root_cells.size()-1) % root_cells.size());
+  toLeaf(sweep_level, true);
+  return root_number != (root_cells.size()-1);
+}
+
+// Go to the previous leaf cell belonging to this proc
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::ownedPrev(const unsigned sweep_level) {
+  const bool not_loop = prev(sweep_level);
+  return not_loop && cells[level]->belongToThisProc();
+}
+
+// Go to the first leaf cell of first root
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toBegin(const unsigned sweep_level) {
+  toRoot(0);
+  toLeaf(sweep_level, false);
+}
+
+// Go to the first leaf cell of first root belonging to this process
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::toOwnedBegin(const unsigned sweep_level) {
+  owned_roots = findOwnedRootRange(root_cells, owned_roots);
+  if (owned_roots.first == owned_roots.second)
+    return false;
+  toRoot(owned_roots.first);
+  toOwnedLeaf(sweep_level, false);
+  return true;
+}
+
+// Go to the last leaf cell of last root
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toEnd(const unsigned sweep_level) {
+  toRoot(root_cells.size()-1);
+  toLeaf(sweep_level, true);
+}
+
+// Go to the last leaf cell of last root belonging to this process
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::toOwnedEnd(const unsigned sweep_level) {
+  owned_roots = findOwnedRootRange(root_cells, owned_roots);
+  if (owned_roots.first == owned_roots.second)
+    return false;
+  toRoot(owned_roots.second-1);
+  toOwnedLeaf(sweep_level, true);
+  return true;
+}
+
+// Moves the iterator to the cell of a key (false if a leaf cell is met above the key level)
+template<typename CellType, typename TreeIteratorType>
+bool SfcLeafIterator<CellType, TreeIteratorType>::toCellKey(const CellKeyType cell_key) {
+  toRoot(static_cast<unsigned>(cell_key >> key_order_shifts[0]));
+  const unsigned key_level = cell_id_manager.getKeyLevel(cell_key);
+  while (level < key_level) {
+    if (cells[level]->isLeaf())
+      return false;
+    toChild(static_cast<unsigned>((cell_key >> key_order_shifts[level+1]) & key_order_mask));
+  }
+  return true;
+}
+
+// Moves the iterator to a leaf cell of the current cell
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toLeaf(const unsigned sweep_level, const bool reverse) {
+  const unsigned order = reverse ? number_children-1 : 0;
+  while (!cells[level]->isLeaf() && level<sweep_level)
+    toChild(order);
+}
+
+// Moves the iterator to a leaf cell of the current cell that belong to the process
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toOwnedLeaf(const unsigned sweep_level, const bool reverse) {
+  while (!cells[level]->isLeaf() && level<sweep_level) {
+    const auto &sibling_numbers = child_sibling_numbers[orientations[level]];
+    unsigned order{0};
+    for (unsigned i{0}; i<number_children; ++i) {
+      order = reverse ? number_children-1-i : i;
+      if (cells[level]->getChildOct()->getChildCells()[sibling_numbers[order]]->belongToThisProc())
+        break;
+    }
+    toChild(order);
+  }
+}
+
+// Go to child cell
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toChild(const unsigned order) {
+  const unsigned orientation = orientations[level];
+  sibling_cells[level+1] = cells[level]->getChildOct()->getChildCells().data();
+  cells[level+1] = sibling_cells[level+1][child_sibling_numbers[orientation][order]].get();
+  orientations[level+1] = child_orientations[orientation][order];
+  ++level;
+  current_cell_key += CellKeyType(order)*key_order_units[level] + 1;
+}
+
+// Go to the next (or previous) sibling cell of an order
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toSibling(const unsigned order, const bool reverse) {
+  const unsigned orientation = orientations[level-1];
+  cells[level] = sibling_cells[level][child_sibling_numbers[orientation][order]].get();
+  orientations[level] = child_orientations[orientation][order];
+  if (reverse)
+    current_cell_key -= key_order_units[level];
+  else
+    current_cell_key += key_order_units[level];
+}
+
+// Go to parent cell
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toParent() {
+  current_cell_key -= CellKeyType(getOrder())*key_order_units[level] + 1;
+  --level;
+}
+
+// Go to root cell
+template<typename CellType, typename TreeIteratorType>
+void SfcLeafIterator<CellType, TreeIteratorType>::toRoot(const unsigned root_number) {
+  this->root_number = root_number;
+  level = 0;
+  cells[0] = root_cells[root_number].get();
+  orientations[0] = root_orientations[root_number];
+  current_cell_key = cell_id_manager.rootKey(root_number);
+}
@@ -0,0 +1,43 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Range of the root cells belonging to this process. The owned leaves are contiguous along the SFC so
+ *  the owned roots are a contiguous range of root indices, and a known range can be checked in constant time.
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Check that a range [first, last) is the range of the root cells belonging to this process (constant time)
+template<typename CellType>
+bool isOwnedRootRange(const std::vector<std::shared_ptr<CellType>> &root_cells, const std::pair<unsigned, unsigned> &owned_roots) {
+  const unsigned first = owned_roots.first, last = owned_roots.second;
+  if (first>=last || last>root_cells.size())
+    return false;
+  return root_cells[first]->belongToThisProc() && root_cells[last-1]->belongToThisProc()
+      && (first==0 || !root_cells[first-1]->belongToThisProc())
+      && (last==root_cells.size() || !root_cells[last]->belongToThisProc());
+}
+
+// Range [first, last) of the root cells belonging to this process (empty if none), the guess is returned if valid
+// otherwise the root cells are scanned
+template<typename CellType>
+std::pair<unsigned, unsigned> findOwnedRootRange(const std::vector<std::shared_ptr<CellType>> &root_cells, const std::pair<unsigned, unsigned> &guess) {
+  if (isOwnedRootRange(root_cells, guess))
+    return guess;
+
+  unsigned first{0};
+  while (first<root_cells.size() && !root_cells[first]->belongToThisProc())
+    ++first;
+  if (first == root_cells.size())
+    return std::make_pair(0u, 0u);
+  unsigned last = root_cells.size();
+  while (!root_cells[last-1]->belongToThisProc())
+    --last;
+  return std::make_pair(first, last);
+}
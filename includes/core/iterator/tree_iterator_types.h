@@ -17,6 +17,7 @@
 
 #include "HilbertIterator.h"
 #include "MortonIterator.h"
+#include "PeanoIterator.h"
 
 
 //-----------------------------------------------------------//
@@ -32,7 +33,8 @@ namespace tamra::detail {
     MortonIterator<CellType, 213>,
     MortonIterator<CellType, 231>,
     MortonIterator<CellType, 312>,
-    MortonIterator<CellType, 321>
+    MortonIterator<CellType, 321>,
+    PeanoIterator<CellType>
   >;
   
   template<typename IteratorType>
@@ -199,15 +199,17 @@ std::vector<std::vector<std::shared_ptr<CellType>>> BalanceManager<CellType, Tre
 // Exchange cells structure and data
 template<typename CellType, typename TreeIteratorType>
 void BalanceManager<CellType, TreeIteratorType>::exchangeAndCreateCells(const std::vector<std::vector<std::shared_ptr<CellType>>> &cells_to_send, TreeIteratorType &iterator, ExtrapolationFunctionType extrapolation_function) const {
-  // For the first cell we sent the cell ID to be able to locate it.
+  // For the first cell we sent the packed cell key to be able to locate it.
   // For the lacking ines only the level is set to avoid redundant information.
+  const auto cell_id_manager = iterator.getCellIdManager();
   std::vector<std::vector<unsigned>> cells_structure_to_send(size);
   {
     std::vector<unsigned> first_cell_id, cell_levels;
     for (unsigned p{0}; p<size; ++p)
       if (cells_to_send[p].size()) {
-        // First cell ID
-        first_cell_id = iterator.getCellId(cells_to_send[p][0]);
+        // First cell key
+        first_cell_id.clear();
+        cell_id_manager.appendKeyWords(iterator.getCellKey(cells_to_send[p][0]), first_cell_id);
         // Other cells levels
         cell_levels.resize(cells_to_send[p].size() - 1);
         for (size_t i{1}; i<cells_to_send[p].size(); ++i)
@@ -217,13 +219,24 @@ void BalanceManager<CellType, TreeIteratorType>::exchangeAndCreateCells(const st
       }
   }
 
-  // Gather cell data in a vector for sharing between process
+  using CellDataType = typename CellType::CellDataType;
+  constexpr bool packed_data = isPackedCellData<CellDataType>();
+
+  // Gather cell data in a vector for sharing between process (payloads packed in a buffer if possible)
   std::vector<std::vector<std::unique_ptr<ParallelData>>> all_cell_data(size);
-  {
+  std::vector<std::vector<double>> packed_cell_data(size);
+  if constexpr (packed_data) {
+    constexpr std::size_t data_size = packedCellDataSize<CellDataType>();
+    for (unsigned p{0}; p<size; ++p) {
+      packed_cell_data[p].resize(data_size*cells_to_send[p].size());
+      for (size_t i{0}; i<cells_to_send[p].size(); ++i)
+        packCellData(cells_to_send[p][i]->getCellData(), &packed_cell_data[p][data_size*i]);
+    }
+  } else {
     for (unsigned p{0}; p<size; ++p) {
       all_cell_data[p].reserve(cells_to_send[p].size());
       for (size_t i{0}; i<cells_to_send[p].size(); ++i)
-        all_cell_data[p].push_back(std::make_unique<typename CellType::CellDataType>(cells_to_send[p][i]->getCellData()));
+        all_cell_data[p].push_back(std::make_unique<CellDataType>(cells_to_send[p][i]->getCellData()));
     }
   }
 
@@ -236,31 +249,46 @@ void BalanceManager<CellType, TreeIteratorType>::exchangeAndCreateCells(const st
 
   // Exchange cell data
   std::vector<std::unique_ptr<ParallelData>> all_cell_data_recv;
-  vectorDataAlltoallv(all_cell_data, all_cell_data_recv, []() {
-    return std::make_unique<typename CellType::CellDataType>();
-  });
+  std::vector<double> packed_cell_data_recv;
+  if constexpr (packed_data)
+    vectorAlltoallv<double>(packed_cell_data, packed_cell_data_recv);
+  else
+    vectorDataAlltoallv(all_cell_data, all_cell_data_recv, []() {
+      return std::make_unique<CellDataType>();
+    });
+
+  // Set the next received data to a cell
+  unsigned cell_counter = 0;
+  const auto set_received_cell_data = [&](const std::shared_ptr<CellType> &cell) {
+    if constexpr (packed_data) {
+      cell->allocateCellData();
+      unpackCellData(&packed_cell_data_recv[packedCellDataSize<CellDataType>()*cell_counter++], cell->getCellData());
+    } else
+      cell->setCellData(std::unique_ptr<CellDataType>(
+        static_cast<CellDataType*>(all_cell_data_recv[cell_counter++].release())
+      ));
+  };
 
   //std::cout << "P_" << rank << ": recv structure";
   //displayVector(std::cout, cells_structure_recv) << std::endl;
 
   { // Create received cells and set leaf flags to this proc
     std::vector<unsigned> first_cell_id, cell_levels;
-    const unsigned cell_id_size = iterator.getCellIdManager().getCellIdSize();
-    unsigned cell_counter = 0;
+    const unsigned cell_key_size = cell_id_manager.getCellKeySize();
     for (unsigned p{0}; p<size; ++p)
       if (cells_structure_recv[p].size()) {
-        // Insert the first cell ID
-        uncompressCellStructure(cells_structure_recv[p], first_cell_id, cell_levels, cell_id_size);
+        // Insert the first cell key
+        uncompressCellStructure(cells_structure_recv[p], first_cell_id, cell_levels, cell_key_size);
         // Create the first cell and assign it to this proc
-        iterator.toCellId(first_cell_id, true, extrapolation_function);
+        iterator.toCellKey(cell_id_manager.wordsToKey(first_cell_id.data()), true, extrapolation_function);
         iterator.getCell()->setToThisProcRecurs();
         // Set first cell data
-        iterator.getCell()->setCellData(std::unique_ptr<typename CellType::CellDataType>(
-          static_cast<typename CellType::CellDataType*>(all_cell_data_recv[cell_counter++].release())
-        ));
-        if (!iterator.getCell()->isLeaf())
-          // Call extrapolation function on non-leaf cells
+        set_received_cell_data(iterator.getCell());
+        if (!iterator.getCell()->isLeaf()) {
+          // Call extrapolation function on non-leaf cells (only the leaf cells keep data in leaf-only data mode)
           iterator.getCell()->extrapolateRecursively(extrapolation_function);
+          iterator.getCell()->releaseInternalCellData();
+        }
         // Insert the other cells levels
         for (const unsigned &cell_level : cell_levels) {
           iterator.next(cell_level);
@@ -272,13 +300,13 @@ void BalanceManager<CellType, TreeIteratorType>::exchangeAndCreateCells(const st
           iterator.getCell()->setToThisProcRecurs();
 
           // Set cell data
-          iterator.getCell()->setCellData(std::unique_ptr<typename CellType::CellDataType>(
-            static_cast<typename CellType::CellDataType*>(all_cell_data_recv[cell_counter++].release())
-          ));
+          set_received_cell_data(iterator.getCell());
 
-          if (!iterator.getCell()->isLeaf())
-            // Call extrapolation function on non-leaf cells
+          if (!iterator.getCell()->isLeaf()) {
+            // Call extrapolation function on non-leaf cells (only the leaf cells keep data in leaf-only data mode)
             iterator.getCell()->extrapolateRecursively(extrapolation_function);
+            iterator.getCell()->releaseInternalCellData();
+          }
         }
       }
   }
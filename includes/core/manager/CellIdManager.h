@@ -8,10 +8,25 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
 #include <vector>
 
 template<typename CellType>
 class CellIdManager {
+ public:
+  // Packed cell key: root index in the high bits, one order digit per level (left aligned on the max level)
+  // then the level in the low bits. The vector cell ID is kept for the snapshots and the existing interfaces.
+  // Keys are 128-bit when available so that deep trees fit (communicated with the words needed by the max level only),
+  // or 64-bit when built with USE_64BIT_CELL_KEYS to halve their memory (about 19 levels in 3D and 29 in 2D).
+#if defined(__SIZEOF_INT128__) && !defined(USE_64BIT_CELL_KEYS)
+  using CellKeyType = unsigned __int128;
+#else
+  using CellKeyType = std::uint64_t;
+#endif
+
   //***********************************************************//
 	//  VARIABLES                                                //
 	//***********************************************************//
@@ -22,6 +37,12 @@ class CellIdManager {
   const unsigned max_level;
   // Cell ID unsigned int slots
   unsigned cell_id_size;
+  // Number of bits of the level and of an order digit in a cell key
+  unsigned key_level_bits, key_order_bits;
+  // Number of unsigned words of a cell key when communicated
+  unsigned key_size;
+  // Order digits set to their max value below each level (last finest descendant of a cell)
+  std::vector<CellKeyType> key_last_descendant_masks;
 
   //***********************************************************//
   //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
@@ -38,6 +59,8 @@ class CellIdManager {
  public:
   // Get the size of cell ID vector
   unsigned getCellIdSize() const { return cell_id_size; }
+  // Get the number of unsigned words of a communicated cell key
+  unsigned getCellKeySize() const { return key_size; }
 
   //***********************************************************//
   //  METHODS                                                  //
@@ -77,6 +100,65 @@ class CellIdManager {
   // Check if a cell ID is smaller than or equal another ID
   // True if 1.end <= 2.end
   bool cellIdLte(const std::vector<unsigned> &cell_id_1, const std::vector<unsigned> &cell_id_2) const;
+
+  //--- Packed cell keys --------------------------------------//
+  // Generate a key from the genealogy of a cell
+  CellKeyType orderPathToKey(const std::vector<unsigned> &order_path) const;
+  // Generate the genealogy of a cell from its key
+  std::vector<unsigned> keyToOrderPath(const CellKeyType cell_key) const;
+  // Convert a cell ID to a key
+  CellKeyType idToKey(const std::vector<unsigned> &cell_id) const { return orderPathToKey(idToOrderPath(cell_id)); }
+  // Convert a key to a cell ID
+  std::vector<unsigned> keyToId(const CellKeyType cell_key) const { return orderPathToId(keyToOrderPath(cell_key)); }
+  // Extract the key level
+  unsigned getKeyLevel(const CellKeyType cell_key) const { return static_cast<unsigned>(cell_key & keyLevelMask()); }
+  // Position of the order digit of a level (0 for the root index)
+  unsigned keyOrderShift(const unsigned level) const { return key_level_bits + (max_level - level)*key_order_bits; }
+  // Extract the root index of a key
+  unsigned getKeyRoot(const CellKeyType cell_key) const { return static_cast<unsigned>(cell_key >> keyOrderShift(0)); }
+  // Extract the order digit of a level of a key
+  unsigned getKeyOrder(const CellKeyType cell_key, const unsigned level) const { return static_cast<unsigned>((cell_key >> keyOrderShift(level)) & keyOrderMask()); }
+  // Level of the deepest common ancestor of two keys (-1 if they are under different root cells)
+  int commonAncestorLevel(const CellKeyType cell_key_1, const CellKeyType cell_key_2) const;
+  // Key of a root cell
+  CellKeyType rootKey(const unsigned root_number) const { return CellKeyType(root_number) << keyOrderShift(0); }
+  // Key of a child cell
+  CellKeyType childKey(const CellKeyType cell_key, const unsigned order) const {
+    const unsigned level = getKeyLevel(cell_key);
+    return (cell_key & ~keyLevelMask()) | (CellKeyType(order) << keyOrderShift(level+1)) | (level+1);
+  }
+  // Key of the parent cell
+  CellKeyType parentKey(const CellKeyType cell_key) const {
+    const unsigned level = getKeyLevel(cell_key);
+    return (cell_key & ~keyLevelMask() & ~(keyOrderMask() << keyOrderShift(level))) | (level-1);
+  }
+  // True if 1.start > 2.end
+  bool cellKeyGt(const CellKeyType cell_key_1, const CellKeyType cell_key_2) const { return keyStart(cell_key_1) > keyEnd(cell_key_2); }
+  // True if 1.start >= 2.start
+  bool cellKeyGte(const CellKeyType cell_key_1, const CellKeyType cell_key_2) const { return keyStart(cell_key_1) >= keyStart(cell_key_2); }
+  // True if 1.end < 2.start
+  bool cellKeyLt(const CellKeyType cell_key_1, const CellKeyType cell_key_2) const { return keyEnd(cell_key_1) < keyStart(cell_key_2); }
+  // True if 1.end <= 2.end (same as cellIdLte: true if 1 contains 2, a descendant of 2 must end with it)
+  bool cellKeyLte(const CellKeyType cell_key_1, const CellKeyType cell_key_2) const {
+    const CellKeyType start_1 = keyStart(cell_key_1), start_2 = keyStart(cell_key_2),
+                      end_1 = keyEnd(cell_key_1), end_2 = keyEnd(cell_key_2);
+    if (start_1 <= start_2 && end_2 <= end_1)
+      return true;
+    if (start_2 <= start_1 && end_1 <= end_2)
+      return end_1 == end_2;
+    return end_1 < start_2;
+  }
+  // Append a key to a buffer of getCellKeySize() unsigned words
+  void appendKeyWords(const CellKeyType cell_key, std::vector<unsigned> &words) const;
+  // Read a key from a buffer of getCellKeySize() unsigned words
+  CellKeyType wordsToKey(const unsigned *words) const;
+ private:
+  CellKeyType keyLevelMask() const { return (CellKeyType(1) << key_level_bits) - 1; }
+  CellKeyType keyOrderMask() const { return (CellKeyType(1) << key_order_bits) - 1; }
+  // Position of the first finest descendant
+  CellKeyType keyStart(const CellKeyType cell_key) const { return cell_key & ~keyLevelMask(); }
+  // Position of the last finest descendant
+  CellKeyType keyEnd(const CellKeyType cell_key) const { return keyStart(cell_key) | key_last_descendant_masks[getKeyLevel(cell_key)]; }
  protected:
   // Extract the cell_id level
   virtual int getIdLevel(const std::vector<unsigned> &cell_id) const;
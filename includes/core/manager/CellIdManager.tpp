@@ -10,6 +10,24 @@ CellIdManager<CellType>::CellIdManager(const unsigned number_root_cells, const u
 : number_root_cells(number_root_cells),
   max_level(max_level) {
   cell_id_size = (number_root_cells > 1) ? (max_level+2) : (max_level+1);
+
+  // Packed key layout
+  const auto bitsFor = [](const std::size_t n) {
+    unsigned bits{0};
+    while ((std::size_t(1) << bits) < n)
+      ++bits;
+    return bits;
+  };
+  key_level_bits = bitsFor(max_level+1);
+  key_order_bits = bitsFor(CellType::number_children);
+  const unsigned key_bits = key_level_bits + max_level*key_order_bits + bitsFor(number_root_cells);
+  if (key_bits > 8*sizeof(CellKeyType))
+    throw std::runtime_error("Too many root cells or levels for the cell key size (see USE_64BIT_CELL_KEYS) in CellIdManager::CellIdManager()");
+  key_size = std::max(1u, (key_bits + 31)/32);
+
+  key_last_descendant_masks.assign(max_level+1, 0);
+  for (unsigned level{max_level}; level-->0; )
+    key_last_descendant_masks[level] = key_last_descendant_masks[level+1] | (CellKeyType(CellType::number_children-1) << keyOrderShift(level+1));
 }
 
 
@@ -55,6 +73,67 @@ std::vector<unsigned> CellIdManager<CellType>::idToOrderPath(const std::vector<u
   return order_path;
 }
 
+// Generate a key from the genealogy of a cell
+template<typename CellType>
+typename CellIdManager<CellType>::CellKeyType CellIdManager<CellType>::orderPathToKey(const std::vector<unsigned> &order_path) const {
+  CellKeyType cell_key = rootKey(order_path[0]) | (order_path.size()-1);
+  for (size_t l{1}; l<order_path.size(); ++l)
+    cell_key |= CellKeyType(order_path[l]) << keyOrderShift(l);
+  return cell_key;
+}
+
+// Generate the genealogy of a cell from its key
+template<typename CellType>
+std::vector<unsigned> CellIdManager<CellType>::keyToOrderPath(const CellKeyType cell_key) const {
+  std::vector<unsigned> order_path(getKeyLevel(cell_key)+1);
+  order_path[0] = static_cast<unsigned>(cell_key >> keyOrderShift(0));
+  for (size_t l{1}; l<order_path.size(); ++l)
+    order_path[l] = static_cast<unsigned>((cell_key >> keyOrderShift(l)) & keyOrderMask());
+  return order_path;
+}
+
+// Level of the deepest common ancestor of two keys (-1 if they are under different root cells)
+template<typename CellType>
+int CellIdManager<CellType>::commonAncestorLevel(const CellKeyType cell_key_1, const CellKeyType cell_key_2) const {
+  // Digits that differ down to the shallowest of the two levels
+  const unsigned level = std::min(getKeyLevel(cell_key_1), getKeyLevel(cell_key_2));
+  const CellKeyType diff = (cell_key_1 ^ cell_key_2) & ~((CellKeyType(1) << keyOrderShift(level)) - 1);
+  if (!diff)
+    return static_cast<int>(level);
+  if (diff >> keyOrderShift(0))
+    return -1;
+
+  // Position of the highest differing bit
+#if defined(__SIZEOF_INT128__) && !defined(USE_64BIT_CELL_KEYS)
+  const std::uint64_t high = static_cast<std::uint64_t>(diff >> 64);
+  const unsigned bit = high ? 127 - __builtin_clzll(high) : 63 - __builtin_clzll(static_cast<std::uint64_t>(diff));
+#elif defined(__GNUC__)
+  const unsigned bit = 63 - __builtin_clzll(diff);
+#else
+  unsigned bit{0};
+  for (CellKeyType d = diff >> 1; d; d >>= 1)
+    ++bit;
+#endif
+  // The differing digit belongs to the level below the common ancestor
+  return static_cast<int>(max_level - (bit - key_level_bits)/key_order_bits) - 1;
+}
+
+// Append a key to a buffer of getCellKeySize() unsigned words
+template<typename CellType>
+void CellIdManager<CellType>::appendKeyWords(const CellKeyType cell_key, std::vector<unsigned> &words) const {
+  for (unsigned w{0}; w<key_size; ++w)
+    words.push_back(static_cast<unsigned>(cell_key >> 32*w));
+}
+
+// Read a key from a buffer of getCellKeySize() unsigned words
+template<typename CellType>
+typename CellIdManager<CellType>::CellKeyType CellIdManager<CellType>::wordsToKey(const unsigned *words) const {
+  CellKeyType cell_key{0};
+  for (unsigned w{0}; w<key_size; ++w)
+    cell_key |= CellKeyType(words[w]) << 32*w;
+  return cell_key;
+}
+
 // Generate the IDs of the first and last leaf cells of the
 // partitions obatined by splitting into equal parts and taking
 // the n-th one
@@ -74,7 +153,9 @@ std::vector<std::vector<unsigned>> CellIdManager<CellType>::getEqualPartitions(c
     for (unsigned i{0}; i<=level; ++i) {
       reminder = (reminder < 0) ? 0 : reminder;
       order_path[i] = std::ceil(static_cast<unsigned>(reminder));
-      order_path[i] = (order_path[i] > (CellType::number_children-1)) ? (CellType::number_children-1) : order_path[i];
+      // The first order is the root number
+      const unsigned max_order = (i == 0) ? number_root_cells-1 : CellType::number_children-1;
+      order_path[i] = (order_path[i] > max_order) ? max_order : order_path[i];
       reminder = CellType::number_children * (reminder - order_path[i]);
     }
 
@@ -8,9 +8,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "../../parallel/WorkStealingPool.h"
+
 template<typename CellType>
 class CoarseManager {
   using InterpolationFunctionType = std::function<void(const std::shared_ptr<CellType>&)>;
@@ -40,12 +44,19 @@ class CoarseManager {
   //  METHODS                                                  //
   //***********************************************************//
  public:
-  // Go through all the parent cells and coarse them one time if needed
-	bool coarsen(const std::vector<std::shared_ptr<CellType>> &root_cells, InterpolationFunctionType interpolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }) const;
+  // Coarsen once all the parent cells whose child cells are leaves flagged to be coarsened: the candidate families are
+  // gathered in a single post-order pass and coarsened level by level from the finest one (2:1 balance verified against
+  // the already coarsened levels). With a thread pool, the gathering, the verification and the interpolation run
+  // concurrently over independent subtrees (the interpolation function is then called concurrently)
+	bool coarsen(const std::vector<std::shared_ptr<CellType>> &root_cells, InterpolationFunctionType interpolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }, WorkStealingPool *pool = nullptr) const;
 
  private:
-  // Recursively coarse cells at a specific level
-  bool coarsenToLevelRecurs(const std::shared_ptr<CellType> &cell, const unsigned coarse_level, InterpolationFunctionType interpolation_function) const;
+  // Recursively gather the families to coarsen by level (post-order)
+  void collectFamiliesRecurs(CellType *cell, std::vector<std::vector<CellType*>> &level_families) const;
+  // Recursively gather the subtrees at the chunk level (the families above it are gathered by level)
+  void collectSubtreesRecurs(CellType *cell, const unsigned chunk_level, std::vector<CellType*> &subtrees, std::vector<std::vector<CellType*>> &level_families) const;
+  // Coarsen the families of a level on a thread pool (verification and interpolation are concurrent)
+  bool coarsenFamiliesParallel(const std::vector<CellType*> &families, InterpolationFunctionType &interpolation_function, WorkStealingPool &pool) const;
 };
 
 #include "CoarseManager.tpp"
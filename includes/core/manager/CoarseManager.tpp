@@ -20,36 +20,101 @@ CoarseManager<CellType>::~CoarseManager() {};
 //***********************************************************//
 //  METHODS                                                  //
 //***********************************************************//
-// Go through all the parent cells and coarse them one time if needed
+// Coarsen once all the parent cells whose child cells are leaves flagged to be coarsened
 template<typename CellType>
-bool CoarseManager<CellType>::coarsen(const std::vector<std::shared_ptr<CellType>> &root_cells, InterpolationFunctionType interpolation_function) const {
+bool CoarseManager<CellType>::coarsen(const std::vector<std::shared_ptr<CellType>> &root_cells, InterpolationFunctionType interpolation_function, WorkStealingPool *pool) const {
+  // A coarsened cell is not flagged anymore so the families to coarsen are known before coarsening any of them
+  std::vector<std::vector<CellType*>> level_families(max_level);
+  if (!pool || pool->getNumberThreads() < 2) {
+    for (const auto &root_cell : root_cells)
+      collectFamiliesRecurs(root_cell.get(), level_families);
+  } else {
+    // Independent subtrees at the chunk level
+    unsigned chunk_level{0};
+    for (unsigned long number_chunks = root_cells.size(); number_chunks<16ul*pool->getNumberThreads() && chunk_level<max_level; number_chunks *= CellType::number_children)
+      ++chunk_level;
+    std::vector<CellType*> subtrees;
+    for (const auto &root_cell : root_cells)
+      collectSubtreesRecurs(root_cell.get(), chunk_level, subtrees, level_families);
+
+    std::vector<std::vector<std::vector<CellType*>>> subtree_families(subtrees.size(), std::vector<std::vector<CellType*>>(max_level));
+    pool->run(subtrees.size(), [&](const unsigned subtree, const unsigned thread) {
+      (void)thread;
+      collectFamiliesRecurs(subtrees[subtree], subtree_families[subtree]);
+    });
+    for (unsigned level{chunk_level}; level<max_level; ++level)
+      for (const auto &families : subtree_families)
+        level_families[level].insert(level_families[level].end(), families[level].begin(), families[level].end());
+  }
+
   // Looping on levels starting from high to low level
   bool structure_changed = false;
-  for (unsigned coarse_level=(max_level-1); coarse_level>=min_level; --coarse_level)
-    // Looping on all root cells
-    for (const auto &root_cell : root_cells)
-      // Recursively coarse cells at min level
-      structure_changed |= coarsenToLevelRecurs(root_cell, coarse_level, interpolation_function);
+  for (unsigned level = max_level; level-->min_level; ) {
+    if (pool && pool->getNumberThreads() > 1)
+      structure_changed |= coarsenFamiliesParallel(level_families[level], interpolation_function, *pool);
+    else
+      for (CellType *cell : level_families[level])
+        structure_changed |= cell->coarsen(min_level, interpolation_function);
+  }
   return structure_changed;
 }
 
-// Recursively coarse cells at a specific level
+// Recursively gather the families to coarsen by level (post-order)
 template<typename CellType>
-bool CoarseManager<CellType>::coarsenToLevelRecurs(const std::shared_ptr<CellType> &cell, const unsigned coarse_level, InterpolationFunctionType interpolation_function) const {
-  if (cell->isLeaf() || cell->getLevel()>coarse_level)
-    return false;
-
-  // If the cell is too low level we apply to children
-  if (cell->getLevel() < coarse_level) {
-    bool structure_changed = false;
-    for (const auto &child : cell->getChildCells())
-      structure_changed |= coarsenToLevelRecurs(child, coarse_level, interpolation_function);
-    return structure_changed;
+void CoarseManager<CellType>::collectFamiliesRecurs(CellType *cell, std::vector<std::vector<CellType*>> &level_families) const {
+  if (cell->isLeaf())
+    return;
+
+  bool to_coarsen = true;
+  for (const auto &child : cell->getChildCells()) {
+    collectFamiliesRecurs(child.get(), level_families);
+    to_coarsen &= child->isLeaf() && child->isToCoarse();
   }
+  if (to_coarsen && cell->getLevel()>=min_level)
+    level_families[cell->getLevel()].push_back(cell);
+}
 
-  // Try to coarse the cell
-  for (const auto &child : cell->getChildCells())
-    if (!child->isToCoarse())
-      return false;
-  return cell->coarsen(min_level, interpolation_function);
+// Recursively gather the subtrees at the chunk level (the families above it are gathered by level)
+template<typename CellType>
+void CoarseManager<CellType>::collectSubtreesRecurs(CellType *cell, const unsigned chunk_level, std::vector<CellType*> &subtrees, std::vector<std::vector<CellType*>> &level_families) const {
+  if (cell->isLeaf())
+    return;
+  if (cell->getLevel() == chunk_level) {
+    subtrees.push_back(cell);
+    return;
+  }
+
+  bool to_coarsen = true;
+  for (const auto &child : cell->getChildCells()) {
+    collectSubtreesRecurs(child.get(), chunk_level, subtrees, level_families);
+    to_coarsen &= child->isLeaf() && child->isToCoarse();
+  }
+  if (to_coarsen && cell->getLevel()>=min_level)
+    level_families[cell->getLevel()].push_back(cell);
+}
+
+// Coarsen the families of a level on a thread pool (verification and interpolation are concurrent)
+template<typename CellType>
+bool CoarseManager<CellType>::coarsenFamiliesParallel(const std::vector<CellType*> &families, InterpolationFunctionType &interpolation_function, WorkStealingPool &pool) const {
+  // The families of a level do not change the verification of each other (only the finer levels do)
+  constexpr unsigned block_size{64};
+  std::vector<char> coarsenable(families.size(), 0);
+  pool.run((families.size() + block_size - 1)/block_size, [&](const unsigned block, const unsigned thread) {
+    (void)thread;
+    const std::size_t end = std::min<std::size_t>(families.size(), (block+1)*block_size);
+    for (std::size_t i{block*block_size}; i<end; ++i)
+      if (families[i]->verifyCoarsenNeighbors()) {
+        families[i]->interpolateFromChildren(interpolation_function);
+        coarsenable[i] = 1;
+      }
+  });
+
+  // The octs are released serially (allocator and listeners)
+  bool structure_changed = false;
+  for (std::size_t i{0}; i<families.size(); ++i)
+    if (coarsenable[i]) {
+      families[i]->removeChildCells();
+      structure_changed = true;
+    }
+  return structure_changed;
 }
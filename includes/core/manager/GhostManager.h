@@ -8,11 +8,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "../../parallel/allgather.h"
 #include "../../parallel/alltoallv.h"
+#include "../CellIndex.h"
 
 template<typename CellTypeT, typename TreeIteratorType> class GhostManager;
 
@@ -25,6 +31,8 @@ class GhostManager {
   using ExtrapolationFunctionType = std::function<void(const std::shared_ptr<CellType>&)>;
   using TaskExtrapolationFunctionType = std::function<bool(const std::shared_ptr<CellType>&)>;
   using TreeIteratorType = TreeIteratorTypeT;
+  using CellKeyType = typename TreeIteratorType::CellKeyType;
+  using CellIndexType = CellIndex<CellType, TreeIteratorType>;
   using GhostManagerTaskType = GhostManagerTask<GhostManager<CellTypeT, TreeIteratorType>>;
 
   //***********************************************************//
@@ -77,16 +85,20 @@ class GhostManager {
   //***********************************************************//
  public:
   // Creation of ghost cells and exchange of ghost values
-	GhostManagerTaskType buildGhostLayer(std::vector<std::shared_ptr<CellType>> &root_cells, TreeIteratorType &iterator, const std::vector<int> &directions, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }) const;
+	GhostManagerTaskType buildGhostLayer(std::vector<std::shared_ptr<CellType>> &root_cells, TreeIteratorType &iterator, const std::vector<int> &directions, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }, CellIndexType *cell_index = nullptr) const;
+  // Split the owned leaf cells so that the mesh is 2:1 balanced across the partition boundaries (collective): the
+  // boundary leaf cells are created in the neighbor processes in rounds until no process has new ones to send. Call it
+  // after refining or coarsening so that building the ghost layer does not split owned cells (returns the number of rounds)
+  unsigned balanceLevels(TreeIteratorType &iterator, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }, CellIndexType *cell_index = nullptr) const;
   // Update ghost cells and exchange values for solving conflicts
 	void updateGhostLayer(GhostManagerTaskType &task, TreeIteratorType &iterator) const;
   // Exchange ghost cell values
 	void exchangeGhostValues(GhostManagerTaskType &task, TreeIteratorType &iterator, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }) const;
   // Share the partitions start and end cells
-  void sharePartitions(std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids, TreeIteratorType &iterator) const;
+  void sharePartitions(std::vector<CellKeyType> &begin_keys, std::vector<CellKeyType> &end_keys, TreeIteratorType &iterator) const;
  private:
   // Loop on owned cells and check if neighbors belong to another process
-  void findCellsToSend(const std::vector<std::vector<unsigned>> &begin_ids, const std::vector<std::vector<unsigned>> &end_ids, std::vector<std::vector<std::shared_ptr<CellType>>> &cells_to_send, TreeIteratorType &iterator, const std::vector<int> &directions) const;
+  void findCellsToSend(const std::vector<CellKeyType> &begin_keys, const std::vector<CellKeyType> &end_keys, std::vector<std::vector<std::shared_ptr<CellType>>> &cells_to_send, TreeIteratorType &iterator, const std::vector<int> &directions) const;
   // Set all ghost cells to coarse
   void setGhostToCoarseRecurs(const std::shared_ptr<CellType> &cell) const;
 };
@@ -64,7 +64,7 @@ void GhostManager<CellType, TreeIteratorType>::setDefaultGhostConflictResolution
 
 // Creation of ghost cells and exchange of ghost values
 template<typename CellType, typename TreeIteratorType>
-typename GhostManager<CellType, TreeIteratorType>::GhostManagerTaskType GhostManager<CellType, TreeIteratorType>::buildGhostLayer(std::vector<std::shared_ptr<CellType>> &root_cells, TreeIteratorType &iterator, const std::vector<int> &directions, ExtrapolationFunctionType extrapolation_function) const {
+typename GhostManager<CellType, TreeIteratorType>::GhostManagerTaskType GhostManager<CellType, TreeIteratorType>::buildGhostLayer(std::vector<std::shared_ptr<CellType>> &root_cells, TreeIteratorType &iterator, const std::vector<int> &directions, ExtrapolationFunctionType extrapolation_function, CellIndexType *cell_index) const {
   // If only one process, nothing to do
   if (size == 1)
     return GhostManagerTaskType(this, true);
@@ -83,45 +83,52 @@ typename GhostManager<CellType, TreeIteratorType>::GhostManagerTaskType GhostMan
 
   //std::cout << "P_" << rank << ": nb owned leaves " << old_nb_owned_leaves << std::endl;
 
-  // Share the partitions start and end IDs to be able to determine what cell belongs to what process
-  std::vector<std::vector<unsigned>> begin_ids, end_ids;
-  sharePartitions(begin_ids, end_ids, iterator);
-
-  //std::cout << "P_" << rank << ": start ids";
-  //displayVector(std::cout, begin_ids) << std::endl;
-  //std::cout << "P_" << rank << ": end ids";
-  //displayVector(std::cout, end_ids) << std::endl;
+  // Share the partitions start and end keys to be able to determine what cell belongs to what process
+  std::vector<CellKeyType> begin_keys, end_keys;
+  sharePartitions(begin_keys, end_keys, iterator);
 
   // Loop on owned cells and check if neighbors belong to another process
   std::vector<std::vector<std::shared_ptr<CellType>>> cells_to_send;
-  findCellsToSend(begin_ids, end_ids, cells_to_send, iterator, directions);
+  findCellsToSend(begin_keys, end_keys, cells_to_send, iterator, directions);
 
-  // Share cell IDs of the cells to create on other process
+  // Keep the data of the cells to send if they are split while creating ghost cells (leaf-only data mode)
+  if constexpr (CellType::leaf_only_data)
+    for (unsigned p{0}; p<size; ++p)
+      for (const std::shared_ptr<CellType> &cell : cells_to_send[p])
+        cell->setKeepCellData(true);
+
+  // Share the packed keys of the cells to create on other process
+  const auto cell_id_manager = iterator.getCellIdManager();
   std::vector<std::vector<std::vector<unsigned>>> cell_ids_to_send(size);
   for (unsigned p{0}; p<size; ++p) {
-    cell_ids_to_send[p].reserve(cells_to_send[p].size());
-    for (const std::shared_ptr<CellType> &cell : cells_to_send[p])
-      cell_ids_to_send[p].push_back(iterator.getCellId(cell));
+    cell_ids_to_send[p].resize(cells_to_send[p].size());
+    for (size_t i{0}; i<cells_to_send[p].size(); ++i)
+      cell_id_manager.appendKeyWords(iterator.getCellKey(cells_to_send[p][i]), cell_ids_to_send[p][i]);
   }
 
   //std::cout << "P_" << rank << ": send cell ids ";
   //displayVector(std::cout, cell_ids_to_send) << std::endl;
 
-  const unsigned cell_id_size = iterator.getCellIdManager().getCellIdSize();
   std::vector<std::vector<unsigned>> recv_cell_ids;
-  matrixAlltoallv<unsigned>(cell_ids_to_send, recv_cell_ids, cell_id_size);
+  matrixAlltoallv<unsigned>(cell_ids_to_send, recv_cell_ids, cell_id_manager.getCellKeySize());
 
   //std::cout << "P_" << rank << ": recv cell ids ";
   //displayVector(std::cout, recv_cell_ids) << std::endl;
 
   // Create the cells to receive
   std::vector<std::shared_ptr<CellType>> cells_to_recv(recv_cell_ids.size());
-  for (size_t i{0}; i<recv_cell_ids.size(); ++i) {
-    // Move iterator to cell ID and create it if needed
-    iterator.toCellId(recv_cell_ids[i], true, extrapolation_function);
-
-    cells_to_recv[i] = iterator.getCell();
-  }
+  std::vector<CellKeyType> recv_cell_keys(recv_cell_ids.size());
+  for (size_t i{0}; i<recv_cell_ids.size(); ++i)
+    recv_cell_keys[i] = cell_id_manager.wordsToKey(recv_cell_ids[i].data());
+  // Locate the cells from their keys (in the tree cell index if any) and create them if needed
+  if (cell_index)
+    for (size_t i{0}; i<recv_cell_keys.size(); ++i)
+      cells_to_recv[i] = cell_index->findOrCreate(recv_cell_keys[i], extrapolation_function)->thisAsSmartPtr();
+  else
+    // Keys come sorted along the curve from each process so the iterator moves from one to the next
+    iterator.toCellKeys(recv_cell_keys, true, [&cells_to_recv](const std::shared_ptr<CellType> &cell, const unsigned i) {
+      cells_to_recv[i] = cell;
+    }, extrapolation_function);
 
   // List of ghost cells that need to be extrapolated
   std::vector<std::shared_ptr<CellType>> extrapolate_ghost_cells;
@@ -149,8 +156,14 @@ typename GhostManager<CellType, TreeIteratorType>::GhostManagerTaskType GhostMan
   bool is_finished = extrapolate_owned_cells.size()==0 && extrapolate_ghost_cells.size()==0;
   boolAndAllreduce(is_finished, is_finished);
 
+  // The cells to send split above kept their data until it is sent, later splits release it again (leaf-only data mode)
+  if constexpr (CellType::leaf_only_data)
+    for (unsigned p{0}; p<size; ++p)
+      for (const std::shared_ptr<CellType> &cell : cells_to_send[p])
+        cell->setKeepCellData(false);
+
   // Create an task (keep a copy of arrays needed for exchanging ghost values)
-  GhostManagerTaskType task = GhostManagerTaskType(this, is_finished, std::move(cells_to_send), std::move(cells_to_recv), std::move(extrapolate_owned_cells), std::move(extrapolate_ghost_cells), std::move(begin_ids), std::move(end_ids));
+  GhostManagerTaskType task = GhostManagerTaskType(this, is_finished, std::move(cells_to_send), std::move(cells_to_recv), std::move(extrapolate_owned_cells), std::move(extrapolate_ghost_cells), std::move(begin_keys), std::move(end_keys));
   task.setOwnedExtrapolationFunction(default_owned_extrapolation_function);
   task.setGhostExtrapolationFunction(default_ghost_extrapolation_function);
   task.setOwnedConflictResolutionStrategy({ default_owned_strategies }, default_resend_owned);
@@ -159,6 +172,63 @@ typename GhostManager<CellType, TreeIteratorType>::GhostManagerTaskType GhostMan
   return task;
 }
 
+// Split the owned leaf cells so that the mesh is 2:1 balanced across the partition boundaries (collective)
+template<typename CellType, typename TreeIteratorType>
+unsigned GhostManager<CellType, TreeIteratorType>::balanceLevels(TreeIteratorType &iterator, ExtrapolationFunctionType extrapolation_function, CellIndexType *cell_index) const {
+  // If only one process, nothing to do
+  if (size == 1)
+    return 0;
+
+  // Face neighbors
+  std::vector<int> directions(CellType::number_neighbors);
+  std::iota(directions.begin(), directions.end(), 0);
+
+  // Boundary leaf cells already created in each process (cells are only split during balancing so the pointers stay valid)
+  std::vector<std::unordered_set<const CellType*>> sent_cells(size);
+
+  const auto cell_id_manager = iterator.getCellIdManager();
+  unsigned number_rounds{0};
+  while (true) {
+    // Owned leaf cells having a neighbor in another partition (the partition keys deepen when the boundary cells split)
+    std::vector<CellKeyType> begin_keys, end_keys;
+    sharePartitions(begin_keys, end_keys, iterator);
+    std::vector<std::vector<std::shared_ptr<CellType>>> cells_to_send;
+    findCellsToSend(begin_keys, end_keys, cells_to_send, iterator, directions);
+
+    // Only the boundary leaf cells created since the last round are sent
+    std::vector<std::vector<std::vector<unsigned>>> cell_ids_to_send(size);
+    bool is_finished = true;
+    for (unsigned p{0}; p<size; ++p) {
+      for (const std::shared_ptr<CellType> &cell : cells_to_send[p])
+        if (sent_cells[p].insert(cell.get()).second) {
+          cell_ids_to_send[p].emplace_back();
+          cell_id_manager.appendKeyWords(iterator.getCellKey(cell), cell_ids_to_send[p].back());
+        }
+      is_finished &= cell_ids_to_send[p].empty();
+    }
+    boolAndAllreduce(is_finished, is_finished);
+    if (is_finished)
+      break;
+    ++number_rounds;
+
+    std::vector<std::vector<unsigned>> recv_cell_ids;
+    matrixAlltoallv<unsigned>(cell_ids_to_send, recv_cell_ids, cell_id_manager.getCellKeySize());
+
+    // Creating the received cells splits the coarser owned leaf cells next to them (the extrapolation function is applied
+    // to the split cells)
+    std::vector<CellKeyType> recv_cell_keys(recv_cell_ids.size());
+    for (size_t i{0}; i<recv_cell_ids.size(); ++i)
+      recv_cell_keys[i] = cell_id_manager.wordsToKey(recv_cell_ids[i].data());
+    if (cell_index)
+      for (const CellKeyType &cell_key : recv_cell_keys)
+        cell_index->findOrCreate(cell_key, extrapolation_function);
+    else
+      iterator.toCellKeys(recv_cell_keys, true, [](const std::shared_ptr<CellType> &, const unsigned) {}, extrapolation_function);
+  }
+
+  return number_rounds;
+}
+
 // Update ghost cells and exchange values for solving conflicts
 template<typename CellType, typename TreeIteratorType>
 void GhostManager<CellType, TreeIteratorType>::updateGhostLayer(GhostManagerTaskType &task, TreeIteratorType &iterator) const {
@@ -174,74 +244,104 @@ void GhostManager<CellType, TreeIteratorType>::exchangeGhostValues(GhostManagerT
   if (size == 1)
     return;
 
-  // Gather cell data in a vector for sharing between process
-  std::vector<std::vector<std::unique_ptr<ParallelData>>> all_cell_data(size);
-  for (unsigned p{0}; p<size; ++p) {
-    all_cell_data[p].reserve(task.getCellsToSend()[p].size());
-    for (const auto &cell : task.getCellsToSend()[p])
-      all_cell_data[p].push_back(std::make_unique<typename CellType::CellDataType>(cell->getCellData()));
-  }
+  using CellDataType = typename CellType::CellDataType;
+  const std::vector<std::shared_ptr<CellType>> &cells_to_recv = task.getCellsToRecv();
 
-  // Exchange cell data
-  std::vector<std::unique_ptr<ParallelData>> all_cell_data_recv;
-  vectorDataAlltoallv(all_cell_data, all_cell_data_recv, []() {
-    return std::make_unique<typename CellType::CellDataType>();
-  });
+  if constexpr (isPackedCellData<CellDataType>()) {
+    // Pack cell data payloads in a buffer for sharing between process
+    constexpr std::size_t data_size = packedCellDataSize<CellDataType>();
+    std::vector<std::vector<double>> packed_cell_data(size);
+    for (unsigned p{0}; p<size; ++p) {
+      const auto &cells_to_send = task.getCellsToSend()[p];
+      packed_cell_data[p].resize(data_size*cells_to_send.size());
+      for (size_t i{0}; i<cells_to_send.size(); ++i)
+        packCellData(cells_to_send[i]->getCellData(), &packed_cell_data[p][data_size*i]);
+    }
 
-  // Set cell data to received cells and call extrapolation function on non-leaf cells
-  const std::vector<std::shared_ptr<CellType>> &cells_to_recv = task.getCellsToRecv();
-  for (size_t i{0}; i<cells_to_recv.size(); ++i) {
-    // Set cell data
-    cells_to_recv[i]->setCellData(std::unique_ptr<typename CellType::CellDataType>(
-      static_cast<typename CellType::CellDataType*>(all_cell_data_recv[i].release())
-    ));
+    // Exchange cell data
+    std::vector<double> packed_cell_data_recv;
+    vectorAlltoallv<double>(packed_cell_data, packed_cell_data_recv);
 
+    // Unpack cell data to received cells
+    for (size_t i{0}; i<cells_to_recv.size(); ++i) {
+      cells_to_recv[i]->allocateCellData();
+      unpackCellData(&packed_cell_data_recv[data_size*i], cells_to_recv[i]->getCellData());
+    }
+  } else {
+    // Gather cell data in a vector for sharing between process
+    std::vector<std::vector<std::unique_ptr<ParallelData>>> all_cell_data(size);
+    for (unsigned p{0}; p<size; ++p) {
+      all_cell_data[p].reserve(task.getCellsToSend()[p].size());
+      for (const auto &cell : task.getCellsToSend()[p])
+        all_cell_data[p].push_back(std::make_unique<CellDataType>(cell->getCellData()));
+    }
+
+    // Exchange cell data
+    std::vector<std::unique_ptr<ParallelData>> all_cell_data_recv;
+    vectorDataAlltoallv(all_cell_data, all_cell_data_recv, []() {
+      return std::make_unique<CellDataType>();
+    });
+
+    // Set cell data to received cells
+    for (size_t i{0}; i<cells_to_recv.size(); ++i)
+      cells_to_recv[i]->setCellData(std::unique_ptr<CellDataType>(
+        static_cast<CellDataType*>(all_cell_data_recv[i].release())
+      ));
+  }
+
+  // Call extrapolation function on non-leaf received cells
+  for (size_t i{0}; i<cells_to_recv.size(); ++i)
     if (!cells_to_recv[i]->isLeaf())
-      // Call extrapolation function on non-leaf cells
       cells_to_recv[i]->extrapolateRecursively(extrapolation_function);
-  }
 
   // If the task is not finished, continue unfinished task to resolve conflicts
   if (!task.is_finished)
     task.continueTask(iterator);
+
+  // Only the leaf cells keep data once the values are sent and extrapolated (leaf-only data mode)
+  if constexpr (CellType::leaf_only_data) {
+    for (unsigned p{0}; p<size; ++p)
+      for (const std::shared_ptr<CellType> &cell : task.getCellsToSend()[p])
+        cell->releaseInternalCellData();
+    for (const std::shared_ptr<CellType> &cell : cells_to_recv)
+      cell->releaseInternalCellData();
+  }
 }
 
 // Share the partiion start and end cells
 template<typename CellType, typename TreeIteratorType>
-void GhostManager<CellType, TreeIteratorType>::sharePartitions(std::vector<std::vector<unsigned>> &begin_ids, std::vector<std::vector<unsigned>> &end_ids, TreeIteratorType &iterator) const {
-  std::shared_ptr<CellType> begin_cell, end_cell;
-  std::vector<unsigned> begin_id, end_id;
+void GhostManager<CellType, TreeIteratorType>::sharePartitions(std::vector<CellKeyType> &begin_keys, std::vector<CellKeyType> &end_keys, TreeIteratorType &iterator) const {
+  CellKeyType begin_key, end_key;
   if (iterator.toOwnedBegin()) { // Partition is not empty
-    begin_cell = iterator.getCell();
-    begin_id = iterator.getCellId();
+    begin_key = iterator.getCellKey();
     iterator.toOwnedEnd();
-    end_cell = iterator.getCell();
-    end_id = iterator.getCellId();
+    end_key = iterator.getCellKey();
   } else { // If partition is empty we set start > end
     iterator.toEnd();
-    begin_cell = iterator.getCell();
-    begin_id = iterator.getCellId();
+    begin_key = iterator.getCellKey();
     iterator.toBegin();
-    end_cell = iterator.getCell();
-    end_id = iterator.getCellId();
+    end_key = iterator.getCellKey();
   }
 
-  // All gather the start and end of each process partition
-  std::vector<std::vector<unsigned>> send_partition_ids= { begin_id, end_id }, all_partition_ids;
+  // All gather the start and end of each process partition (packed keys sent as unsigned words)
+  const auto cell_id_manager = iterator.getCellIdManager();
+  std::vector<std::vector<unsigned>> send_partition_ids(2), all_partition_ids;
+  cell_id_manager.appendKeyWords(begin_key, send_partition_ids[0]);
+  cell_id_manager.appendKeyWords(end_key, send_partition_ids[1]);
   matrixAllgather<unsigned>(send_partition_ids, all_partition_ids, size);
 
   // Format outputs
-  begin_ids.resize(size);
-  end_ids.resize(size);
+  begin_keys.resize(size);
+  end_keys.resize(size);
   for (unsigned p{0}; p<size; ++p) {
-    begin_ids[p] = all_partition_ids[2*p];
-    end_ids[p] = all_partition_ids[2*p+1];
+    begin_keys[p] = cell_id_manager.wordsToKey(all_partition_ids[2*p].data());
+    end_keys[p] = cell_id_manager.wordsToKey(all_partition_ids[2*p+1].data());
   }
 }
 
 // Loop on owned cells and check if neighbors belong to another process
 template<typename CellType, typename TreeIteratorType>
-void GhostManager<CellType, TreeIteratorType>::findCellsToSend(const std::vector<std::vector<unsigned>> &begin_ids, const std::vector<std::vector<unsigned>> &end_ids, std::vector<std::vector<std::shared_ptr<CellType>>> &cells_to_send, TreeIteratorType &iterator, const std::vector<int> &directions) const {
+void GhostManager<CellType, TreeIteratorType>::findCellsToSend(const std::vector<CellKeyType> &begin_keys, const std::vector<CellKeyType> &end_keys, std::vector<std::vector<std::shared_ptr<CellType>>> &cells_to_send, TreeIteratorType &iterator, const std::vector<int> &directions) const {
   // Cell ID manager
   typename TreeIteratorType::CellIdManagerType cell_id_manager = iterator.getCellIdManager();
 
@@ -254,56 +354,56 @@ void GhostManager<CellType, TreeIteratorType>::findCellsToSend(const std::vector
   if (!iterator.toOwnedBegin())
     return;
 
-  // Get
-  // Non void partitions processes
+  // Partition splitters: non void partitions of the other processes in SFC order
   std::vector<int> non_void_proc;
   non_void_proc.reserve(size);
   for (unsigned p{0}; p<size; ++p)
-    if ((p!=rank) && cell_id_manager.cellIdLte(begin_ids[p], end_ids[p]))
+    if ((p!=rank) && cell_id_manager.cellKeyLte(begin_keys[p], end_keys[p]))
       non_void_proc.push_back(p);
 
-  //for (const int p: non_void_proc)
-  //  std::cout << "P_" << rank << ": " << p << " non void" << std::endl;
+  // Range of the splitters overlapping each ghost neighbor cell already met (binary search on the first meeting)
+  std::unordered_map<const CellType*, std::pair<unsigned, unsigned>> neighbor_owners;
 
   // Main loop on cells in partition
-  std::shared_ptr<CellType> cell, neighbor_cell;
-  std::vector<unsigned> neighbor_id;
-  std::vector<bool> found(size);
+  CellType *cell, *neighbor_cell;
+  std::vector<int> found_procs;
   do {
-    cell = iterator.getCell();
+    cell = iterator.getCellPtr();
 
     // Loop on cell's neighbors
-    // Connect the neighbors in the root's child_oct
-    std::fill(found.begin(), found.end(), false);
-    bool allTrue;
+    found_procs.clear();
     for (const auto dir : directions) {
       // If cell already shared with all proc no need to add it again
-      allTrue = true;
-      for (const int p : non_void_proc)
-        allTrue &= found[p];
-      if (allTrue)
+      if (found_procs.size() == non_void_proc.size())
         break;
 
-      // Get the neighbor cell ID
+      // Get the neighbor cell
       neighbor_cell = cell->getNeighborCell(dir);
       if (!neighbor_cell || neighbor_cell->belongToThisProc())
         continue;
-      neighbor_id = iterator.getCellId(neighbor_cell);
-
-      //std::cout << "P_" << rank << " dir " << dir << " -> ";
-      //displayVector(std::cout, neighbor_id) << std::endl;
-
-      // Check if the neighbor cell cross other process partitions
-      for (const int p : non_void_proc)
-        if (!found[p] &&
-            !cell_id_manager.cellIdGt(begin_ids[p], neighbor_id) &&
-            !cell_id_manager.cellIdGt(neighbor_id, end_ids[p])) {
-          //std::cout << "P_" << rank << " proc " << p << " needs ";
-          //displayVector(std::cout, iterator.getCellId()) << std::endl;
-          cells_to_send[p].push_back(cell);
-          found[p] = true;
+
+      // Find the partitions crossed by the neighbor cell
+      auto owners = neighbor_owners.find(neighbor_cell);
+      if (owners == neighbor_owners.end()) {
+        const CellKeyType neighbor_key = iterator.getCellKey(neighbor_cell);
+        const auto first = std::partition_point(non_void_proc.begin(), non_void_proc.end(), [&](const int p) {
+          return cell_id_manager.cellKeyGt(neighbor_key, end_keys[p]);
+        });
+        const auto last = std::partition_point(first, non_void_proc.end(), [&](const int p) {
+          return !cell_id_manager.cellKeyGt(begin_keys[p], neighbor_key);
+        });
+        owners = neighbor_owners.emplace(neighbor_cell, std::make_pair(first - non_void_proc.begin(), last - non_void_proc.begin())).first;
+      }
+
+      // Send the cell to the first of these partitions that does not have it yet
+      for (unsigned i{owners->second.first}; i<owners->second.second; ++i) {
+        const int p = non_void_proc[i];
+        if (std::find(found_procs.begin(), found_procs.end(), p) == found_procs.end()) {
+          cells_to_send[p].push_back(iterator.getCell());
+          found_procs.push_back(p);
           break;
         }
+      }
     }
   } while (iterator.ownedNext());
 }
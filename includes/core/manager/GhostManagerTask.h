@@ -43,6 +43,7 @@ class GhostManagerTask {
   using CellType = typename GhostManagerType::CellType;
   using ExtrapolationFunctionType = typename GhostManagerType::TaskExtrapolationFunctionType;
   using TreeIteratorType = typename GhostManagerType::TreeIteratorType;
+  using CellKeyType = typename GhostManagerType::CellKeyType;
 
   //***********************************************************//
   //  VARIABLES                                                //
@@ -61,10 +62,10 @@ class GhostManagerTask {
   std::vector<std::shared_ptr<CellType>> extrapolate_owned_cells;
   // Ghost cells that were found split in this process
   std::vector<std::shared_ptr<CellType>> extrapolate_ghost_cells;
-  // IDs of the first cells on each of the process
-  std::vector<std::vector<unsigned>> partition_begin_ids;
-  // IDs of the last cells on each of the process
-  std::vector<std::vector<unsigned>> partition_end_ids;
+  // Keys of the first cells on each of the process
+  std::vector<CellKeyType> partition_begin_keys;
+  // Keys of the last cells on each of the process
+  std::vector<CellKeyType> partition_end_keys;
   // Function on how to interpolate owned cell values to children
   ExtrapolationFunctionType owned_extrapolation_function;
   // Function on how to interpolate ghost cell values to children
@@ -83,7 +84,7 @@ class GhostManagerTask {
   // Constructor
   GhostManagerTask();
   GhostManagerTask(const GhostManagerType *ghost_manager, const bool is_finished);
-  GhostManagerTask(const GhostManagerType *ghost_manager, const bool is_finished, std::vector<std::vector<std::shared_ptr<CellType>>> &&cells_to_send, std::vector<std::shared_ptr<CellType>> &&cells_to_recv, std::vector<std::shared_ptr<CellType>> &&extrapolate_owned_cells, std::vector<std::shared_ptr<CellType>> &&extrapolate_ghost_cells, std::vector<std::vector<unsigned>> &&partition_begin_ids, std::vector<std::vector<unsigned>> &&partition_end_ids);
+  GhostManagerTask(const GhostManagerType *ghost_manager, const bool is_finished, std::vector<std::vector<std::shared_ptr<CellType>>> &&cells_to_send, std::vector<std::shared_ptr<CellType>> &&cells_to_recv, std::vector<std::shared_ptr<CellType>> &&extrapolate_owned_cells, std::vector<std::shared_ptr<CellType>> &&extrapolate_ghost_cells, std::vector<CellKeyType> &&partition_begin_keys, std::vector<CellKeyType> &&partition_end_keys);
   // Destructor
   ~GhostManagerTask();
 
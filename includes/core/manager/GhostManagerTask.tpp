@@ -17,15 +17,15 @@ GhostManagerTask<GhostManagerType>::GhostManagerTask(const GhostManagerType *gho
   is_finished(is_finished) {}
 
 template<typename GhostManagerType>
-GhostManagerTask<GhostManagerType>::GhostManagerTask(const GhostManagerType *ghost_manager, const bool is_finished, std::vector<std::vector<std::shared_ptr<CellType>>> &&cells_to_send, std::vector<std::shared_ptr<CellType>> &&cells_to_recv, std::vector<std::shared_ptr<CellType>> &&extrapolate_owned_cells, std::vector<std::shared_ptr<CellType>> &&extrapolate_ghost_cells, std::vector<std::vector<unsigned>> &&partition_begin_ids, std::vector<std::vector<unsigned>> &&partition_end_ids)
+GhostManagerTask<GhostManagerType>::GhostManagerTask(const GhostManagerType *ghost_manager, const bool is_finished, std::vector<std::vector<std::shared_ptr<CellType>>> &&cells_to_send, std::vector<std::shared_ptr<CellType>> &&cells_to_recv, std::vector<std::shared_ptr<CellType>> &&extrapolate_owned_cells, std::vector<std::shared_ptr<CellType>> &&extrapolate_ghost_cells, std::vector<CellKeyType> &&partition_begin_keys, std::vector<CellKeyType> &&partition_end_keys)
 : ghost_manager(ghost_manager),
   is_finished(is_finished),
   cells_to_send(cells_to_send),
   cells_to_recv(cells_to_recv),
   extrapolate_owned_cells(extrapolate_owned_cells),
   extrapolate_ghost_cells(extrapolate_ghost_cells),
-  partition_begin_ids(partition_begin_ids),
-  partition_end_ids(partition_end_ids) {}
+  partition_begin_keys(std::move(partition_begin_keys)),
+  partition_end_keys(std::move(partition_end_keys)) {}
 
 // Destructor
 template<typename GhostManagerType>
@@ -175,6 +175,7 @@ std::vector<bool> GhostManagerTask<GhostManagerType>::continueTaskGhost(TreeIter
 
 template<typename GhostManagerType>
 bool GhostManagerTask<GhostManagerType>::applyExtrapolationFunctionRecurs(const std::shared_ptr<CellType> &cell, const ExtrapolationFunctionType &extrapolation_function) {
+  cell->allocateChildCellData();
   bool success = extrapolation_function(cell);
   for (auto &child : cell->getChildCells())
     if (!child->isLeaf())
@@ -0,0 +1,136 @@
+/*
+ *
+ *  Copyright (c) 2026 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Class that flags the owned leaves for refinement and coarsening from an error indicator. The global
+ *  thresholds of the fixed fraction and fixed number strategies and of the leaf budget are found from histograms of
+ *  the errors reduced over the processes (one allreduce per round, a single round by default, the errors are never
+ *  gathered).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "../FieldRegistry.h"
+#include "../../parallel/WorkStealingPool.h"
+#include "../../parallel/allreduce.h"
+
+// Enumeration for strategies on how to select the leaves to refine and coarsen from their errors.
+// Possible values are:
+// - `THRESHOLD`:      Refine the leaves whose error is at least `refine` and coarsen those below `coarsen`
+// - `FIXED_FRACTION`: Refine the largest errors summing to the fraction `refine` of the global error of the leaves
+//                     below max level and coarsen the smallest ones summing to at most the fraction `coarsen` of the
+//                     global error (leaves without error are never refined)
+// - `FIXED_NUMBER`:   Refine the fraction `refine` of the global number of leaves with the largest errors and coarsen
+//                     at most the fraction `coarsen` of it with the smallest errors
+enum class MarkStrategy {
+  THRESHOLD,
+  FIXED_FRACTION,
+  FIXED_NUMBER,
+};
+
+// Parameters of a marking
+struct MarkParameters {
+  // Selection strategy
+  MarkStrategy strategy = MarkStrategy::FIXED_FRACTION;
+  // Refinement and coarsening error values (THRESHOLD) or fractions (FIXED_FRACTION and FIXED_NUMBER)
+  double refine = 0.3;
+  double coarsen = 0.;
+  // Max global number of leaves once the flagged leaves are split (0 for no budget, the 2:1 balance splits are not
+  // counted)
+  unsigned long max_leaves = 0;
+  // Number of histogram rounds (one allreduce each): a single round places the thresholds of FIXED_FRACTION,
+  // FIXED_NUMBER and of the budget on power of two bins (more leaves refined, fewer coarsened and the budget kept with a
+  // margin), each extra round narrows them 256 times (3 rounds usually give exact selections)
+  unsigned number_rounds = 1;
+};
+
+// Number of owned leaves flagged by a marking
+struct MarkCounts {
+  // Leaf cells flagged to be refined
+  std::size_t number_refine;
+  // Leaf cells flagged to be coarsened
+  std::size_t number_coarsen;
+};
+
+template<typename CellType>
+class MarkManager {
+  // Number of bins of the histograms (the first round bins the errors by power of two)
+  static constexpr unsigned number_bins = 256;
+  // Search of a global error threshold, the interval [low, high) holding it is split in bins at each round
+  struct ThresholdSearch {
+    // Selects the largest errors (error >= threshold) or the smallest ones (error < threshold)
+    bool top;
+    // The target is an upper bound (budget) or a lower bound on the selection
+    bool at_most;
+    // The target is an error sum or a number of leaves
+    bool by_error;
+    // Candidates are the leaves that can be refined or those that can be coarsened
+    bool refine;
+    // Target of the selection (set once the global totals are known)
+    double target;
+    // Interval holding the threshold
+    double low, high;
+    // Error sum or number of candidates beyond the interval on the selected side
+    double outside;
+    // Threshold once found
+    bool done;
+    double threshold;
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+  // Minimum mesh level
+  const unsigned min_level;
+  // Maximum mesh level
+  const unsigned max_level;
+  // Process rank
+  const unsigned rank;
+  // Number of process
+  const unsigned size;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public :
+  // Constructor
+  MarkManager(const unsigned min_level, const unsigned max_level, const unsigned rank, const unsigned size);
+  // Destructor
+  ~MarkManager();
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Flag the owned leaves for refinement and coarsening from their errors (collective, the flags of the leaves are
+  // replaced and negative errors count as zero). With a thread pool, the histograms and the flagging run concurrently
+  // over blocks of leaves
+  MarkCounts mark(const std::vector<CellType*> &cells, FieldSpan<const double> errors, const MarkParameters &parameters, WorkStealingPool *pool = nullptr) const;
+
+ private:
+  // Fill the histograms of the searches not done yet (leaf counts then error sums of each search, followed by the
+  // global number of leaves and error sum)
+  void fillHistograms(const std::vector<CellType*> &cells, FieldSpan<const double> errors, const std::vector<ThresholdSearch> &searches, const unsigned round, std::vector<double> &histograms, WorkStealingPool *pool) const;
+  // Narrow a search to the bin where its target is reached
+  void narrowSearch(ThresholdSearch &search, const double *counts, const double *sums, const unsigned round) const;
+  // Set the threshold of a search from its interval
+  static void finishSearch(ThresholdSearch &search);
+  // Lower edge of a bin of the interval of a search (the first round bins by power of two)
+  static double binEdge(const ThresholdSearch &search, const unsigned round, const unsigned bin);
+  // Bin of an error in the interval of a search
+  static unsigned findBin(const ThresholdSearch &search, const unsigned round, const double error);
+  // Apply a function to blocks [begin, end) of leaves (concurrently with a thread pool)
+  template<typename Function>
+  static void applyToBlocks(const std::size_t number_leaves, WorkStealingPool *pool, Function &&f);
+};
+
+#include "MarkManager.tpp"
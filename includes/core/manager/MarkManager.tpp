@@ -0,0 +1,241 @@
+#include "MarkManager.h"
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor
+template<typename CellType>
+MarkManager<CellType>::MarkManager(const unsigned min_level, const unsigned max_level, const unsigned rank, const unsigned size)
+: min_level(min_level),
+  max_level(max_level),
+  rank(rank),
+  size(size) {}
+
+// Destructor
+template<typename CellType>
+MarkManager<CellType>::~MarkManager() {};
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Flag the owned leaves for refinement and coarsening from their errors
+template<typename CellType>
+MarkCounts MarkManager<CellType>::mark(const std::vector<CellType*> &cells, FieldSpan<const double> errors, const MarkParameters &parameters, WorkStealingPool *pool) const {
+  if (errors.size() != cells.size())
+    throw std::runtime_error("Number of errors different from the number of leaves in MarkManager::mark()");
+  if (parameters.strategy != MarkStrategy::THRESHOLD && (parameters.refine < 0. || parameters.refine > 1. || parameters.coarsen < 0. || parameters.coarsen > 1.))
+    throw std::runtime_error("Fractions outside [0, 1] in MarkManager::mark()");
+
+  // Searches of the global thresholds: largest errors to refine, smallest errors to coarsen and leaf budget
+  const double infinity = std::numeric_limits<double>::infinity();
+  std::vector<ThresholdSearch> searches;
+  if (parameters.strategy != MarkStrategy::THRESHOLD) {
+    const bool by_error = parameters.strategy == MarkStrategy::FIXED_FRACTION;
+    searches.push_back(ThresholdSearch{true, false, by_error, true, 0., 0., infinity, 0., false, 0.});
+    searches.push_back(ThresholdSearch{false, true, by_error, false, 0., 0., infinity, 0., false, 0.});
+  }
+  if (parameters.max_leaves > 0)
+    searches.push_back(ThresholdSearch{true, true, false, true, 0., 0., infinity, 0., false, 0.});
+
+  // Narrow the thresholds with one allreduce of the histograms per round
+  std::vector<double> histograms, global_histograms;
+  for (unsigned round{0}; round<std::max(1u, parameters.number_rounds) && !searches.empty(); ++round) {
+    fillHistograms(cells, errors, searches, round, histograms, pool);
+    if (size > 1)
+      vectorSumAllreduce<double>(histograms, global_histograms);
+    else
+      global_histograms.swap(histograms);
+
+    // Targets from the global number of leaves and error sum (the refined error fraction is taken over the leaves
+    // below max level since only they can be refined)
+    if (round == 0) {
+      const double number_leaves = global_histograms[global_histograms.size()-2], error_sum = global_histograms.back();
+      // Each split leaf adds number_children-1 leaves
+      const double number_splits = parameters.max_leaves > number_leaves ? std::floor((parameters.max_leaves - number_leaves)/(CellType::number_children - 1)) : 0.;
+      for (std::size_t s{0}; s<searches.size(); ++s) {
+        ThresholdSearch &search = searches[s];
+        if (search.top && search.at_most)
+          search.target = number_splits;
+        else if (!search.by_error)
+          search.target = (search.refine ? parameters.refine : parameters.coarsen)*number_leaves;
+        else if (search.refine) {
+          const double *sums = &global_histograms[(2*s+1)*number_bins];
+          search.target = parameters.refine*std::accumulate(sums, sums + number_bins, 0.);
+        } else
+          search.target = parameters.coarsen*error_sum;
+      }
+    }
+
+    bool all_done{true};
+    for (std::size_t s{0}; s<searches.size(); ++s)
+      if (!searches[s].done) {
+        narrowSearch(searches[s], &global_histograms[2*s*number_bins], &global_histograms[(2*s+1)*number_bins], round);
+        all_done &= searches[s].done;
+      }
+    if (all_done)
+      break;
+  }
+
+  // Thresholds (the budget can only raise the refinement one)
+  double refine_threshold = parameters.strategy == MarkStrategy::THRESHOLD ? parameters.refine : 0.,
+         coarsen_threshold = parameters.strategy == MarkStrategy::THRESHOLD ? parameters.coarsen : 0.;
+  for (ThresholdSearch &search : searches) {
+    if (!search.done)
+      finishSearch(search);
+    // Leaves without error never count toward an error fraction
+    if (search.refine && search.by_error)
+      refine_threshold = std::max(refine_threshold, std::numeric_limits<double>::denorm_min());
+    if (search.refine)
+      refine_threshold = std::max(refine_threshold, search.threshold);
+    else
+      coarsen_threshold = search.threshold;
+  }
+
+  // Flag the leaves
+  const unsigned number_threads = pool ? pool->getNumberThreads() : 1;
+  std::vector<MarkCounts> thread_counts(number_threads, MarkCounts{0, 0});
+  applyToBlocks(cells.size(), pool, [&](const std::size_t begin, const std::size_t end, const unsigned thread) {
+    MarkCounts &counts = thread_counts[thread];
+    for (std::size_t i{begin}; i<end; ++i) {
+      CellType *cell = cells[i];
+      const double error = errors[i] > 0. ? errors[i] : 0.;
+      const unsigned level = cell->getLevel();
+      if (level < max_level && error >= refine_threshold) {
+        cell->setToRefine();
+        ++counts.number_refine;
+      } else if (level > min_level && error < coarsen_threshold) {
+        cell->setToCoarse();
+        ++counts.number_coarsen;
+      } else
+        cell->setToUnchange();
+    }
+  });
+
+  MarkCounts counts{0, 0};
+  for (const MarkCounts &thread_count : thread_counts) {
+    counts.number_refine += thread_count.number_refine;
+    counts.number_coarsen += thread_count.number_coarsen;
+  }
+  return counts;
+}
+
+// Fill the histograms of the searches not done yet
+template<typename CellType>
+void MarkManager<CellType>::fillHistograms(const std::vector<CellType*> &cells, FieldSpan<const double> errors, const std::vector<ThresholdSearch> &searches, const unsigned round, std::vector<double> &histograms, WorkStealingPool *pool) const {
+  const std::size_t histogram_size = 2*searches.size()*number_bins + 2;
+  const unsigned number_threads = pool ? pool->getNumberThreads() : 1;
+  std::vector<std::vector<double>> thread_histograms(number_threads, std::vector<double>(histogram_size, 0.));
+  applyToBlocks(cells.size(), pool, [&](const std::size_t begin, const std::size_t end, const unsigned thread) {
+    std::vector<double> &histogram = thread_histograms[thread];
+    for (std::size_t i{begin}; i<end; ++i) {
+      const double error = errors[i] > 0. ? errors[i] : 0.;
+      const unsigned level = cells[i]->getLevel();
+      histogram[histogram_size-2] += 1.;
+      histogram[histogram_size-1] += error;
+      for (std::size_t s{0}; s<searches.size(); ++s) {
+        const ThresholdSearch &search = searches[s];
+        if (search.done || (search.refine ? level >= max_level : level <= min_level) || error < search.low || error >= search.high)
+          continue;
+        const unsigned bin = findBin(search, round, error);
+        histogram[2*s*number_bins + bin] += 1.;
+        histogram[(2*s+1)*number_bins + bin] += error;
+      }
+    }
+  });
+
+  histograms = std::move(thread_histograms[0]);
+  for (unsigned thread{1}; thread<number_threads; ++thread)
+    for (std::size_t i{0}; i<histogram_size; ++i)
+      histograms[i] += thread_histograms[thread][i];
+}
+
+// Narrow a search to the bin where its target is reached
+template<typename CellType>
+void MarkManager<CellType>::narrowSearch(ThresholdSearch &search, const double *counts, const double *sums, const unsigned round) const {
+  const double infinity = std::numeric_limits<double>::infinity();
+  if (search.target <= 0.) {
+    search.threshold = search.top ? infinity : 0.;
+    search.done = true;
+    return;
+  }
+
+  // Accumulate the bins from the selected side
+  double cumulated = search.outside;
+  for (unsigned k{0}; k<number_bins; ++k) {
+    const unsigned bin = search.top ? number_bins-1-k : k;
+    const double value = search.by_error ? sums[bin] : counts[bin];
+    const bool reached = search.at_most ? cumulated + value > search.target : cumulated + value >= search.target;
+    if (!reached) {
+      cumulated += value;
+      continue;
+    }
+
+    const double low = binEdge(search, round, bin), high = binEdge(search, round, bin+1);
+    search.low = low;
+    search.high = high;
+    search.outside = cumulated;
+    // A single leaf or an interval that cannot be split anymore
+    if (counts[bin] <= 1. || !std::isfinite(high) || !(low < high))
+      finishSearch(search);
+    return;
+  }
+
+  // Target not reached with all the candidates (all of them are selected)
+  search.threshold = search.top ? 0. : infinity;
+  search.done = true;
+}
+
+// Set the threshold of a search from its interval (the selection stays within an upper bound)
+template<typename CellType>
+void MarkManager<CellType>::finishSearch(ThresholdSearch &search) {
+  search.threshold = search.top && search.at_most ? search.high : search.low;
+  search.done = true;
+}
+
+// Lower edge of a bin of the interval of a search (the first round bins by power of two)
+template<typename CellType>
+double MarkManager<CellType>::binEdge(const ThresholdSearch &search, const unsigned round, const unsigned bin) {
+  if (bin == number_bins)
+    return search.high;
+  if (round == 0)
+    return bin == 0 ? 0. : std::ldexp(1., static_cast<int>(bin) - 127);
+  return search.low + (search.high - search.low)*bin/number_bins;
+}
+
+// Bin of an error in the interval of a search
+template<typename CellType>
+unsigned MarkManager<CellType>::findBin(const ThresholdSearch &search, const unsigned round, const double error) {
+  // Bin 0 holds [0, 2^-126) and bin b holds [2^(b-127), 2^(b-126)) up to the last one
+  if (round == 0) {
+    if (error <= 0.)
+      return 0;
+    return static_cast<unsigned>(std::min(std::max(std::ilogb(error), -127), 128) + 127);
+  }
+
+  // Bins of equal width (moved to agree with the rounding of the bin edges)
+  unsigned bin = static_cast<unsigned>(std::min<double>(number_bins-1, (error - search.low)/(search.high - search.low)*number_bins));
+  while (bin > 0 && error < binEdge(search, round, bin))
+    --bin;
+  while (bin+1 < number_bins && error >= binEdge(search, round, bin+1))
+    ++bin;
+  return bin;
+}
+
+// Apply a function to blocks [begin, end) of leaves (concurrently with a thread pool)
+template<typename CellType>
+template<typename Function>
+void MarkManager<CellType>::applyToBlocks(const std::size_t number_leaves, WorkStealingPool *pool, Function &&f) {
+  if (!pool || pool->getNumberThreads() < 2) {
+    f(0, number_leaves, 0);
+    return;
+  }
+
+  // A few blocks per thread for the work stealing
+  const unsigned number_blocks = 4*pool->getNumberThreads();
+  pool->run(number_blocks, [&f, number_leaves, number_blocks](const unsigned block, const unsigned thread) {
+    f(number_leaves*block/number_blocks, number_leaves*(block+1)/number_blocks, thread);
+  });
+}
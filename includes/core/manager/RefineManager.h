@@ -8,8 +8,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <memory>
+#include <vector>
+
+// Number of cells split by a bulk refinement
+struct RefineCounts {
+  // Leaf cells flagged to be refined
+  std::size_t number_flagged;
+  // Coarser leaf cells split to keep the 2:1 balance
+  std::size_t number_balance;
+};
 
 template<typename CellType>
 class RefineManager {
@@ -42,10 +53,17 @@ class RefineManager {
  public:
   // Go through all the leaf cells and split them one time if needed.
 	bool refine(const std::vector<std::shared_ptr<CellType>> &root_cells, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }) const;
+  // Split all the flagged leaf cells at once: the 2:1 closure is computed level by level from the finest one, then
+  // the cells are split from the coarsest level (no recursive neighbor splitting)
+  RefineCounts refineBulk(const std::vector<std::shared_ptr<CellType>> &root_cells, ExtrapolationFunctionType extrapolation_function = [](const std::shared_ptr<CellType> &cell) { (void)cell; }) const;
 
  private:
   // Recursively refine child cells if needed
   bool refineRecurs(const std::shared_ptr<CellType> &cell, ExtrapolationFunctionType extrapolation_function) const;
+  // Recursively collect the leaf cells to refine by level
+  void collectToRefineRecurs(CellType *cell, std::vector<std::vector<CellType*>> &level_cells) const;
+  // Leaf cell already collected as flagged for refinement
+  bool isCollected(const CellType *cell) const;
 };
 
 #include "RefineManager.tpp"
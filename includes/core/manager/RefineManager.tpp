@@ -49,3 +49,75 @@ bool RefineManager<CellType>::refineRecurs(const std::shared_ptr<CellType> &cell
   }
   return structure_changed;
 }
+
+// Split all the flagged leaf cells at once: the 2:1 closure is computed level by level from the finest one, then
+// the cells are split from the coarsest level (no recursive neighbor splitting)
+template<typename CellType>
+RefineCounts RefineManager<CellType>::refineBulk(const std::vector<std::shared_ptr<CellType>> &root_cells, ExtrapolationFunctionType extrapolation_function) const {
+  RefineCounts counts{0, 0};
+  if (max_level == 0)
+    return counts;
+
+  // Leaf cells to split for each level, the flagged cells are kept in tree order (locality of the new octs)
+  std::vector<std::vector<CellType*>> level_cells(max_level);
+  for (const auto &root_cell : root_cells)
+    collectToRefineRecurs(root_cell.get(), level_cells);
+  std::vector<std::size_t> number_level_flagged(max_level);
+  for (unsigned level{0}; level<max_level; ++level) {
+    number_level_flagged[level] = level_cells[level].size();
+    counts.number_flagged += level_cells[level].size();
+  }
+
+  // Balance ripple: the coarser leaf neighbors of the cells of a level are split too, they are added to the coarser
+  // levels which are processed next (only the added cells need to be deduplicated)
+  std::size_t number_split{0};
+  for (unsigned level = max_level; level-->0; ) {
+    std::vector<CellType*> &cells = level_cells[level];
+    const auto balance_begin = cells.begin() + number_level_flagged[level];
+    std::sort(balance_begin, cells.end());
+    cells.erase(std::unique(balance_begin, cells.end()), cells.end());
+    number_split += cells.size();
+    for (CellType *cell : cells) {
+      if (cell->isRoot())
+        continue;
+      for (unsigned dir{0}; dir<CellType::number_neighbors; ++dir) {
+        CellType *neighbor_cell = cell->getNeighborCell(dir);
+        if (neighbor_cell && neighbor_cell->isLeaf() && neighbor_cell->getLevel()<level && !isCollected(neighbor_cell))
+          level_cells[neighbor_cell->getLevel()].push_back(neighbor_cell);
+      }
+    }
+  }
+  counts.number_balance = number_split - counts.number_flagged;
+  if (number_split == 0)
+    return counts;
+
+  // The octs are taken from a single slab
+  if (auto *oct_allocator = root_cells.front()->getOctAllocator())
+    oct_allocator->reserveBlocks(number_split);
+
+  // Split from the coarsest level so that the neighbors are never split again
+  for (const auto &cells : level_cells)
+    for (CellType *cell : cells)
+      cell->split(max_level, extrapolation_function);
+
+  return counts;
+}
+
+// Leaf cell already collected as flagged for refinement
+template<typename CellType>
+bool RefineManager<CellType>::isCollected(const CellType *cell) const {
+  return cell->belongToThisProc() && cell->isToRefine() && (cell->getLevel()<max_level);
+}
+
+// Recursively collect the leaf cells to refine by level
+template<typename CellType>
+void RefineManager<CellType>::collectToRefineRecurs(CellType *cell, std::vector<std::vector<CellType*>> &level_cells) const {
+  if (!cell->belongToThisProc() || (cell->getLevel()>=max_level))
+    return;
+
+  if (!cell->isLeaf()) {
+    for (const auto &child : cell->getChildCells())
+      collectToRefineRecurs(child.get(), level_cells);
+  } else if (cell->isToRefine())
+    level_cells[cell->getLevel()].push_back(cell);
+}
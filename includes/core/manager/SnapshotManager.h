@@ -18,7 +18,6 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <core/RootCellEntry.h>
@@ -50,6 +49,7 @@ class SnapshotMetadata {
 template<typename TreeType>
 class SnapshotManager {
   using CellType = typename TreeType::CellType;
+  using CellDataType = typename CellType::CellDataType;
   static constexpr unsigned VERSION_NUMBER = 1;
   static constexpr unsigned SUBVERSION_NUMBER = 0;
 
@@ -124,6 +124,14 @@ class SnapshotManager {
   void dumpCellData(const TreeType& tree, std::ostream& os);
   // Restore the tree cells data from an input stream
   void restoreCellData(TreeType& tree, std::istream& is);
+  // Dump a cell data to an output stream (payload written with memcpy in binary mode if possible)
+  static void dumpData(const CellDataType &data, std::ostream& os, const bool binary);
+  // Restore a cell data from an input stream (payload read with memcpy in binary mode if possible)
+  static void restoreData(CellDataType &data, std::istream& is, const bool binary);
+  // True if the cell data is part of the snapshot (only leaf cells in leaf-only data mode)
+  static bool isSnapshotDataCell(const CellType &cell) { return !CellType::leaf_only_data || cell.isLeaf(); };
+  // Count the cells whose data is part of the snapshot
+  unsigned countSnapshotDataCells(const TreeType& tree) const;
   // Set a parent to belong to this rank if any child does, otherwise mark it as non-owned
   bool backPropagateOwnershipFlags(const std::shared_ptr<CellType> &cell) const;
   // Dump a canonical empty-partition tree payload to an output stream
@@ -132,6 +140,10 @@ class SnapshotManager {
   void dumpEmptyPartitionLeafCells(const TreeType& tree, std::ostream& os);
   // Dump the canonical empty-partition cell data to an output stream
   void dumpEmptyPartitionCellData(const TreeType& tree, std::ostream& os);
+  // True if the cell data is part of the empty-partition payload (level 1 cells and leaf roots in leaf-only data mode)
+  static bool isEmptyPartitionDataCell(const CellType &cell) { return !CellType::leaf_only_data || cell.getLevel()==1 || cell.isLeaf(); };
+  // Dump the data of an empty-partition cell (default data if the cell holds none)
+  static void dumpEmptyPartitionData(const CellType &cell, std::ostream& os, const bool binary);
 };
 
 #include "SnapshotManager.tpp"
@@ -206,11 +206,7 @@ void SnapshotManager<TreeType>::dumpRootCells(const TreeType& tree, std::ostream
 
   // Dump the number of root cells
   os << "ROOT_CELLS " << tree.getRootCells().size() << "\n";
-  // For each root cell, dump its data
-  std::unordered_map<CellType*, unsigned> root_cell_indices;
-  for (const auto& root_cell : tree.getRootCells())
-    root_cell_indices[root_cell.get()] = root_cell_indices.size();
-  // For each root cell, find the neighboring root cells
+  // For each root cell, find the neighboring root cells (the root index is stored in the cell)
   std::vector<std::vector<int>> root_cell_neighbors(tree.getRootCells().size());
   for (size_t i{0}; i<tree.getRootCells().size(); ++i) {
     // initialize with out-of-range index (use size as sentinel)
@@ -218,7 +214,7 @@ void SnapshotManager<TreeType>::dumpRootCells(const TreeType& tree, std::ostream
     const auto& root_cell = tree.getRootCells()[i];
     for (unsigned dir{0}; dir<CellType::number_neighbors; ++dir)
       if (root_cell->getNeighborCell(dir))
-        root_cell_neighbors[i][dir] = root_cell_indices[root_cell->getNeighborCell(dir).get()];
+        root_cell_neighbors[i][dir] = root_cell->getNeighborCell(dir)->getRootIndex();
   }
   // Dump the root cell neighbors
   for (size_t i{0}; i<tree.getRootCells().size(); ++i) {
@@ -384,6 +380,7 @@ void SnapshotManager<TreeType>::restoreLeafCellsWithIterator(TreeType& tree, std
   // Backpropagate flags from leaf to all cells
   for (const auto &root_cell : tree.getRootCells())
     backPropagateOwnershipFlags(root_cell);
+  tree.updateOwnedRoots();
 }
 
 // Dump the tree cells data to an output stream
@@ -391,18 +388,21 @@ template<typename TreeType>
 void SnapshotManager<TreeType>::dumpCellData(const TreeType& tree, std::ostream& os) {
   using CellType = typename TreeType::CellType;
 
-  os << "CELL_DATA " << tree.countCells() << "\n";
+  os << "CELL_DATA " << countSnapshotDataCells(tree) << "\n";
   if (this->binary) {
     tree.applyToAllCells(
       [&os](const std::shared_ptr<CellType> &cell, unsigned) mutable {
-        cell->getCellData().dump(os, true);
+        if (isSnapshotDataCell(*cell))
+          dumpData(cell->getCellData(), os, true);
       }
     );
   } else {
     unsigned counter{0};
     tree.applyToAllCells(
       [&os, &counter](const std::shared_ptr<CellType> &cell, unsigned) mutable {
-        cell->getCellData().dump(os, false);
+        if (!isSnapshotDataCell(*cell))
+          return;
+        dumpData(cell->getCellData(), os, false);
         if (++counter%10==0)
           os << "\n";
       }
@@ -421,7 +421,7 @@ void SnapshotManager<TreeType>::restoreCellData(TreeType& tree, std::istream& is
   expect(is, "CELL_DATA");
   const unsigned number_cells = get<unsigned>(is);
   is.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Ignore line break
-  if (number_cells != tree.countCells())
+  if (number_cells != countSnapshotDataCells(tree))
     throw std::runtime_error("SnapshotManager::restoreCellData: cell count mismatch");
   if (number_cells > 0) {
     // Restore the tree cells
@@ -429,12 +429,25 @@ void SnapshotManager<TreeType>::restoreCellData(TreeType& tree, std::istream& is
     tree.applyToAllCells(
       [&is, &binary](const std::shared_ptr<CellType> &cell, unsigned) mutable {
         // Restoring the values of the cells
-        cell->getCellData().restore(is, binary);
+        if (isSnapshotDataCell(*cell))
+          restoreData(cell->getCellData(), is, binary);
       }
     );
   }
 }
 
+// Count the cells whose data is part of the snapshot
+template<typename TreeType>
+unsigned SnapshotManager<TreeType>::countSnapshotDataCells(const TreeType& tree) const {
+  if (!CellType::leaf_only_data)
+    return tree.countCells();
+
+  unsigned number_cells = 0;
+  for (const auto &root_cell : tree.getRootCells())
+    number_cells += root_cell->countLeaves();
+  return number_cells;
+}
+
 // Set a parent to belong to this rank if any child does, otherwise mark it as non-owned
 template<typename TreeType>
 bool SnapshotManager<TreeType>::backPropagateOwnershipFlags(const std::shared_ptr<CellType> &cell) const {
@@ -506,7 +519,7 @@ void SnapshotManager<TreeType>::dumpEmptyPartitionCellData(const TreeType& tree,
   unsigned nb_level_1_cells = 0;
   tree.applyToAllCells(
     [&nb_level_1_cells](const std::shared_ptr<CellType> &cell, unsigned) mutable {
-      if (cell->getLevel() <= 1)
+      if (cell->getLevel() <= 1 && isEmptyPartitionDataCell(*cell))
         nb_level_1_cells++;
     }
   );
@@ -516,16 +529,16 @@ void SnapshotManager<TreeType>::dumpEmptyPartitionCellData(const TreeType& tree,
   if (this->binary) {
     tree.applyToAllCells(
       [&os](const std::shared_ptr<CellType> &cell, unsigned) mutable {
-        if (cell->getLevel() <= 1)
-          cell->getCellData().dump(os, true);
+        if (cell->getLevel() <= 1 && isEmptyPartitionDataCell(*cell))
+          dumpEmptyPartitionData(*cell, os, true);
       }
     );
   } else {
     unsigned counter{0};
     tree.applyToAllCells(
       [&os, &counter](const std::shared_ptr<CellType> &cell, unsigned) mutable {
-        if (cell->getLevel() <= 1) {
-          cell->getCellData().dump(os, false);
+        if (cell->getLevel() <= 1 && isEmptyPartitionDataCell(*cell)) {
+          dumpEmptyPartitionData(*cell, os, false);
           if (++counter%10==0)
             os << "\n";
         }
@@ -535,3 +548,40 @@ void SnapshotManager<TreeType>::dumpEmptyPartitionCellData(const TreeType& tree,
       os << "\n";
   }
 }
+
+// Dump the data of an empty-partition cell (default data if the cell holds none)
+template<typename TreeType>
+void SnapshotManager<TreeType>::dumpEmptyPartitionData(const CellType &cell, std::ostream& os, const bool binary) {
+  if (cell.hasCellData())
+    dumpData(cell.getCellData(), os, binary);
+  else
+    dumpData(typename CellType::CellDataType(), os, binary);
+}
+
+// Dump a cell data to an output stream (payload written with memcpy in binary mode if possible)
+template<typename TreeType>
+void SnapshotManager<TreeType>::dumpData(const CellDataType &data, std::ostream& os, const bool binary) {
+  if constexpr (isPackedCellData<CellDataType>()) {
+    if (binary) {
+      typename CellDataTraits<CellDataType>::PayloadType payload;
+      CellDataTraits<CellDataType>::pack(data, payload);
+      os.write(reinterpret_cast<const char*>(&payload), sizeof(payload));
+      return;
+    }
+  }
+  data.dump(os, binary);
+}
+
+// Restore a cell data from an input stream (payload read with memcpy in binary mode if possible)
+template<typename TreeType>
+void SnapshotManager<TreeType>::restoreData(CellDataType &data, std::istream& is, const bool binary) {
+  if constexpr (isPackedCellData<CellDataType>()) {
+    if (binary) {
+      typename CellDataTraits<CellDataType>::PayloadType payload;
+      is.read(reinterpret_cast<char*>(&payload), sizeof(payload));
+      CellDataTraits<CellDataType>::unpack(payload, data);
+      return;
+    }
+  }
+  data.restore(is, binary);
+}
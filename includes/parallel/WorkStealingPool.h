@@ -0,0 +1,88 @@
+/*
+ *
+ *  Copyright (c) 2025 Sofiane BOUSABAA
+ *  Licensed under the MIT License (see LICENSE file in project root)
+ *
+ *  Description: Pool of persistent threads running batches of indexed tasks. Each thread starts with a contiguous block
+ *  of tasks (keeps the SFC locality) and steals from the back of the other threads blocks once its own is done.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+ public:
+  // Task function (task index, thread index)
+  using TaskFunctionType = std::function<void(const unsigned, const unsigned)>;
+
+ private:
+  // Tasks of a thread (popped from the front by its thread and stolen from the back by the others)
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<unsigned> tasks;
+  };
+
+  //***********************************************************//
+  //  VARIABLES                                                //
+  //***********************************************************//
+ private:
+  // Number of threads (including the calling thread)
+  const unsigned number_threads;
+  // Worker threads (the calling thread is the thread 0)
+  std::vector<std::thread> threads;
+  // Task queue of each thread
+  std::vector<std::unique_ptr<TaskQueue>> queues;
+  // Synchronization of the batches
+  std::mutex mutex;
+  std::condition_variable start_condition, done_condition;
+  // Task function of the current batch
+  const TaskFunctionType *task_function;
+  // Batch counter (wakes up the workers)
+  unsigned long batch;
+  // Number of workers still running the current batch
+  unsigned number_running;
+  // First exception thrown by a task of the current batch
+  std::exception_ptr task_exception;
+  // Stop the workers
+  bool stop;
+
+  //***********************************************************//
+  //  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+  //***********************************************************//
+ public:
+  // Constructor (0 threads means the number of hardware threads)
+  explicit WorkStealingPool(const unsigned number_threads = 0);
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+  // Destructor (joins the workers)
+  ~WorkStealingPool();
+
+  //***********************************************************//
+  //  ACCESSORS                                                //
+  //***********************************************************//
+ public:
+  // Get the number of threads (including the calling thread)
+  unsigned getNumberThreads() const { return number_threads; };
+
+  //***********************************************************//
+  //  METHODS                                                  //
+  //***********************************************************//
+ public:
+  // Run the tasks [0, number_tasks) and wait for their completion (the first exception thrown by a task is rethrown)
+  void run(const unsigned number_tasks, const TaskFunctionType &f);
+ private:
+  // Worker thread loop
+  void workerLoop(const unsigned thread);
+  // Run own tasks then steal tasks from the other threads
+  void work(const unsigned thread);
+  // Pop a task from the front of the own queue or from the back of another queue
+  bool popTask(const unsigned thread, unsigned &task);
+};
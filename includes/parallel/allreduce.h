@@ -16,6 +16,7 @@
 #endif // USE_MPI
 
 #include <numeric>
+#include <vector>
 
 //-----------------------------------------------------------//
 //  PROTOTYPES                                               //
@@ -29,6 +30,9 @@ void scalarSumAllreduce(const T value, T &reduction);
 template<typename T>
 void scalarMinAllreduce(const T value, T &reduction);
 
+template<typename T>
+void vectorSumAllreduce(const std::vector<T> &values, std::vector<T> &reduction);
+
 //-----------------------------------------------------------//
 //  LOWER LEVEL METHODS                                      //
 //-----------------------------------------------------------//
@@ -96,3 +100,20 @@ void scalarMinAllreduce(const T value, T &reduction) {
   allreduce::detail::scalarAllreduceT(value, reduction);
 #endif // USE_MPI
 }
+
+template<typename T>
+void vectorSumAllreduce(const std::vector<T> &values, std::vector<T> &reduction) {
+  static_assert(
+    std::is_same<T, double>::value || std::is_same<T, unsigned>::value,
+    "vectorSumAllreduce only supports T = double or unsigned"
+  );
+
+  reduction.resize(values.size());
+#ifdef USE_MPI
+	// Element-wise reduction of the values between all processors
+  MPI_Allreduce(values.data(), reduction.data(), static_cast<int>(values.size()), mpi_type<T>(), MPI_SUM, MPI_COMM_WORLD);
+#else
+	// No MPI, so one proc then reduction is values
+  reduction = values;
+#endif // USE_MPI
+}
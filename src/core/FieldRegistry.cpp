@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <core/FieldRegistry.h>
+#include <parallel/allgather.h>
+#include <parallel/alltoallv.h>
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor
+FieldRegistry::FieldRegistry()
+: number_leaves(0) {}
+
+
+//***********************************************************//
+//  ACCESSORS                                                //
+//***********************************************************//
+
+// True if a field is registered
+bool FieldRegistry::hasField(const std::string &name) const {
+  return std::any_of(fields.begin(), fields.end(), [&name](const Field &field) { return field.name == name; });
+}
+
+// Get the number of components of a field
+unsigned FieldRegistry::getNumberComponents(const std::string &name) const {
+  return findField(name).number_components;
+}
+
+// Get a component of a field
+FieldSpan<double> FieldRegistry::getField(const std::string &name, const unsigned component) {
+  Field &field = findField(name);
+  if (component >= field.number_components)
+    throw std::runtime_error("Invalid component of field " + name + " in FieldRegistry::getField()");
+  return FieldSpan<double>(field.values.data() + component*number_leaves, number_leaves);
+}
+FieldSpan<const double> FieldRegistry::getField(const std::string &name, const unsigned component) const {
+  const Field &field = findField(name);
+  if (component >= field.number_components)
+    throw std::runtime_error("Invalid component of field " + name + " in FieldRegistry::getField()");
+  return FieldSpan<const double>(field.values.data() + component*number_leaves, number_leaves);
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Register a field (values are initialized to zero)
+void FieldRegistry::addField(const std::string &name, const unsigned number_components, const std::size_t number_leaves) {
+  if (hasField(name))
+    throw std::runtime_error("Field " + name + " already registered in FieldRegistry::addField()");
+  if (number_components == 0)
+    throw std::runtime_error("Field " + name + " must have at least one component in FieldRegistry::addField()");
+  if (!fields.empty() && number_leaves != this->number_leaves)
+    throw std::runtime_error("Number of leaves differs from the registered fields in FieldRegistry::addField()");
+
+  this->number_leaves = number_leaves;
+  fields.push_back(Field{name, number_components, std::vector<double>(number_components*number_leaves, 0.)});
+}
+
+// Remove a field
+void FieldRegistry::removeField(const std::string &name) {
+  fields.erase(std::remove_if(fields.begin(), fields.end(), [&name](const Field &field) { return field.name == name; }), fields.end());
+}
+
+// Remap the fields after a refinement or a coarsening given the levels and ownership of all the leaves along the SFC before and after
+// - new leaves inside an old leaf get its value
+// - a new leaf covering old leaves gets their volume weighted average
+void FieldRegistry::remap(const std::vector<unsigned char> &old_levels, const std::vector<bool> &old_owned, const std::vector<unsigned char> &new_levels, const std::vector<bool> &new_owned, const unsigned number_children) {
+  constexpr double epsilon = 1e-12;
+  const std::size_t new_number_leaves = std::count(new_owned.begin(), new_owned.end(), true);
+
+  // Old owned leaves (and their weights) contributing to each new owned leaf
+  std::vector<std::size_t> map_offsets(1, 0), map_indices;
+  std::vector<double> map_weights;
+  map_offsets.reserve(new_number_leaves + 1);
+  map_indices.reserve(std::max(number_leaves, new_number_leaves));
+  map_weights.reserve(std::max(number_leaves, new_number_leaves));
+
+  // Walk both leaf sequences (they cover the same domain in the same order)
+  std::size_t i{0}, j{0}, old_index{0};
+  while (i<old_levels.size() && j<new_levels.size()) {
+    const unsigned old_level = old_levels[i], new_level = new_levels[j];
+    if (old_level <= new_level) {
+      // New leaves inside the old leaf i
+      double remaining = 1.;
+      while (remaining > epsilon && j<new_levels.size()) {
+        if (new_owned[j]) {
+          if (old_owned[i]) {
+            map_indices.push_back(old_index);
+            map_weights.push_back(1.);
+          }
+          map_offsets.push_back(map_indices.size());
+        }
+        remaining -= std::pow(static_cast<double>(number_children), -static_cast<double>(new_levels[j] - old_level));
+        ++j;
+      }
+      old_index += old_owned[i];
+      ++i;
+    } else {
+      // Old leaves inside the new leaf j
+      double remaining = 1., total_weight = 0.;
+      const std::size_t first = map_indices.size();
+      while (remaining > epsilon && i<old_levels.size()) {
+        const double weight = std::pow(static_cast<double>(number_children), -static_cast<double>(old_levels[i] - new_level));
+        if (old_owned[i]) {
+          map_indices.push_back(old_index);
+          map_weights.push_back(weight);
+          total_weight += weight;
+        }
+        remaining -= weight;
+        old_index += old_owned[i];
+        ++i;
+      }
+      if (new_owned[j]) {
+        for (std::size_t k{first}; k<map_weights.size(); ++k)
+          map_weights[k] /= total_weight;
+        map_offsets.push_back(map_indices.size());
+      } else {
+        map_indices.resize(first);
+        map_weights.resize(first);
+      }
+      ++j;
+    }
+  }
+  if (map_offsets.size() != new_number_leaves + 1)
+    throw std::runtime_error("Leaf sequences do not cover the same domain in FieldRegistry::remap()");
+
+  // Apply the mapping to all field components
+  for (Field &field : fields) {
+    std::vector<double> values(field.number_components*new_number_leaves, 0.);
+    for (unsigned c{0}; c<field.number_components; ++c) {
+      const double *old_values = field.values.data() + c*number_leaves;
+      double *new_values = values.data() + c*new_number_leaves;
+      for (std::size_t l{0}; l<new_number_leaves; ++l)
+        for (std::size_t k{map_offsets[l]}; k<map_offsets[l+1]; ++k)
+          new_values[l] += map_weights[k]*old_values[map_indices[k]];
+    }
+    field.values = std::move(values);
+  }
+  number_leaves = new_number_leaves;
+}
+
+// Redistribute the fields after a load balancing (the owned leaves keep their global SFC order)
+void FieldRegistry::redistribute(const std::size_t new_number_leaves, const unsigned rank, const unsigned size) {
+  std::vector<unsigned> old_counts, new_counts;
+  scalarAllgather<unsigned>(number_leaves, old_counts, size);
+  scalarAllgather<unsigned>(new_number_leaves, new_counts, size);
+  redistribute(old_counts, new_counts, rank);
+}
+
+// Redistribute the fields after a load balancing given the number of owned leaves of each process before and after
+void FieldRegistry::redistribute(const std::vector<unsigned> &old_counts, const std::vector<unsigned> &new_counts, const unsigned rank) {
+  const unsigned size = old_counts.size();
+  const std::size_t new_number_leaves = new_counts[rank];
+
+  // Global SFC offsets of the partitions before and after
+  std::vector<std::size_t> old_offsets(size+1, 0), new_offsets(size+1, 0);
+  for (unsigned p{0}; p<size; ++p) {
+    old_offsets[p+1] = old_offsets[p] + old_counts[p];
+    new_offsets[p+1] = new_offsets[p] + new_counts[p];
+  }
+
+  // Send the overlap of the old partition with the new partition of each process
+  std::vector<std::vector<double>> send_buffers(size);
+  for (unsigned p{0}; p<size; ++p) {
+    const std::size_t begin = std::max(old_offsets[rank], new_offsets[p]),
+                      end   = std::min(old_offsets[rank+1], new_offsets[p+1]);
+    if (begin >= end)
+      continue;
+    for (const Field &field : fields)
+      for (unsigned c{0}; c<field.number_components; ++c) {
+        const auto first = field.values.begin() + c*number_leaves + (begin - old_offsets[rank]);
+        send_buffers[p].insert(send_buffers[p].end(), first, first + (end - begin));
+      }
+  }
+  std::vector<std::vector<double>> recv_buffers;
+  vectorAlltoallv<double>(send_buffers, recv_buffers);
+
+  // Receive the overlap of the old partition of each process with the new partition
+  std::vector<std::vector<double>> values(fields.size());
+  for (std::size_t f{0}; f<fields.size(); ++f)
+    values[f].resize(fields[f].number_components*new_number_leaves);
+  for (unsigned p{0}; p<size; ++p) {
+    const std::size_t begin = std::max(old_offsets[p], new_offsets[rank]),
+                      end   = std::min(old_offsets[p+1], new_offsets[rank+1]);
+    if (begin >= end)
+      continue;
+    auto first = recv_buffers[p].begin();
+    for (std::size_t f{0}; f<fields.size(); ++f)
+      for (unsigned c{0}; c<fields[f].number_components; ++c) {
+        std::copy(first, first + (end - begin), values[f].begin() + c*new_number_leaves + (begin - new_offsets[rank]));
+        first += end - begin;
+      }
+  }
+  for (std::size_t f{0}; f<fields.size(); ++f)
+    fields[f].values = std::move(values[f]);
+  number_leaves = new_number_leaves;
+}
+
+// Find a field by name (throws if not found)
+FieldRegistry::Field& FieldRegistry::findField(const std::string &name) {
+  for (Field &field : fields)
+    if (field.name == name)
+      return field;
+  throw std::runtime_error("Field " + name + " not registered in FieldRegistry::findField()");
+}
+const FieldRegistry::Field& FieldRegistry::findField(const std::string &name) const {
+  for (const Field &field : fields)
+    if (field.name == name)
+      return field;
+  throw std::runtime_error("Field " + name + " not registered in FieldRegistry::findField()");
+}
@@ -0,0 +1,132 @@
+#include <algorithm>
+
+#include <parallel/WorkStealingPool.h>
+
+//***********************************************************//
+//  CONSTRUCTORS, DESTRUCTOR AND INITIALIZATION              //
+//***********************************************************//
+
+// Constructor (0 threads means the number of hardware threads)
+WorkStealingPool::WorkStealingPool(const unsigned number_threads)
+: number_threads(number_threads > 0 ? number_threads : std::max(1u, std::thread::hardware_concurrency())),
+  task_function(nullptr),
+  batch(0),
+  number_running(0),
+  stop(false) {
+  for (unsigned thread{0}; thread<this->number_threads; ++thread)
+    queues.push_back(std::make_unique<TaskQueue>());
+  for (unsigned thread{1}; thread<this->number_threads; ++thread)
+    threads.emplace_back(&WorkStealingPool::workerLoop, this, thread);
+}
+
+// Destructor (joins the workers)
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  start_condition.notify_all();
+  for (auto &thread : threads)
+    thread.join();
+}
+
+
+//***********************************************************//
+//  METHODS                                                  //
+//***********************************************************//
+
+// Run the tasks [0, number_tasks) and wait for their completion (the first exception thrown by a task is rethrown)
+void WorkStealingPool::run(const unsigned number_tasks, const TaskFunctionType &f) {
+  // Nothing to share
+  if (number_threads == 1 || number_tasks <= 1) {
+    for (unsigned task{0}; task<number_tasks; ++task)
+      f(task, 0);
+    return;
+  }
+
+  // Contiguous blocks of tasks
+  for (unsigned thread{0}; thread<number_threads; ++thread) {
+    TaskQueue &queue = *queues[thread];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    const unsigned begin = static_cast<unsigned>((static_cast<unsigned long>(number_tasks)*thread)/number_threads);
+    const unsigned end = static_cast<unsigned>((static_cast<unsigned long>(number_tasks)*(thread+1))/number_threads);
+    queue.tasks.clear();
+    for (unsigned task{begin}; task<end; ++task)
+      queue.tasks.push_back(task);
+  }
+
+  // Wake up the workers and take part in the batch
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    task_function = &f;
+    task_exception = nullptr;
+    number_running = number_threads-1;
+    ++batch;
+  }
+  start_condition.notify_all();
+  work(0);
+
+  // Wait for the workers
+  std::unique_lock<std::mutex> lock(mutex);
+  done_condition.wait(lock, [this] { return number_running == 0; });
+  task_function = nullptr;
+  if (task_exception)
+    std::rethrow_exception(task_exception);
+}
+
+// Worker thread loop
+void WorkStealingPool::workerLoop(const unsigned thread) {
+  unsigned long last_batch{0};
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      start_condition.wait(lock, [this, last_batch] { return stop || batch != last_batch; });
+      if (stop)
+        return;
+      last_batch = batch;
+    }
+    work(thread);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      --number_running;
+    }
+    done_condition.notify_one();
+  }
+}
+
+// Run own tasks then steal tasks from the other threads
+void WorkStealingPool::work(const unsigned thread) {
+  unsigned task;
+  while (popTask(thread, task)) {
+    try {
+      (*task_function)(task, thread);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!task_exception)
+        task_exception = std::current_exception();
+    }
+  }
+}
+
+// Pop a task from the front of the own queue or from the back of another queue
+bool WorkStealingPool::popTask(const unsigned thread, unsigned &task) {
+  {
+    TaskQueue &queue = *queues[thread];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+  for (unsigned i{1}; i<number_threads; ++i) {
+    TaskQueue &queue = *queues[(thread+i) % number_threads];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
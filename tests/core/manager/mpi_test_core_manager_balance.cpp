@@ -1,5 +1,6 @@
 #include <doctest.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -7,6 +8,7 @@
 #include <core/iterator/MortonIterator.h>
 #include <core/RootCellEntry.h>
 #include <core/Tree.h>
+#include <parallel/allgather.h>
 #include <parallel/allreduce.h>
 
 // Load balancing (empty partitions)
@@ -251,6 +253,90 @@ TEST_CASE("[core][manager][balance][mpi] Load balancing (empty partitions, custo
   CHECK(all_passed);
 }
 
+namespace core::manager::balance {
+// Cell data only held by leaf cells
+class LeafOnlyCellData : public CellData {};
+}
+
+template<>
+struct CellDataTraits<core::manager::balance::LeafOnlyCellData> : CellDataTraits<CellData> {
+  static constexpr bool leaf_only = true;
+};
+
+// Load balancing (empty partitions) with data only held by leaf cells
+// Same as the data exchange test: the received cells are created with data only on the leaf cells
+TEST_CASE("[core][manager][balance][mpi] Load balancing (empty partitions, leaf-only data)") {
+  using Cell2D = Cell<2, 2, 0, core::manager::balance::LeafOnlyCellData>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell2D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell2D> eA{A};
+  std::vector<RootCellEntry<Cell2D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{2}, max_level{3};
+  Tree<Cell2D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+
+  // Split to level 3 in process 1
+  if (rank == 1) {
+    unsigned counter = 0;
+    for (const auto &child : A->getChildCells())
+      if (++counter%2 == 0)
+        child->split(max_level);
+    for (const auto &child : A->getChildCells())
+      if (++counter%2 == 0)
+        for (const auto &gc : child->getChildCells())
+          if (++counter%2 == 0)
+            gc->split(max_level);
+    A->setToThisProcRecurs();
+  } else
+    A->setToOtherProcRecurs();
+
+  // Set cell values
+  MortonIterator<Cell2D> iterator(tree.getRootCells(), tree.getMaxLevel());
+  if (iterator.toOwnedBegin())
+    do {
+      iterator.getCell()->getCellData().setValue(iterator.getCell()->getLevel());
+    } while (iterator.ownedNext());
+
+  // Load balance the tree
+  tree.loadBalance();
+
+  // Count number of owned leaf cells
+  unsigned number_leaf_cells = A->countOwnedLeaves();
+
+  // Compute the sum of all the leaf cells owned
+  unsigned total_leaf_cells;
+  scalarSumAllreduce<unsigned>(number_leaf_cells, total_leaf_cells);
+
+  // Also the number of cells should be equally distributed
+  bool passed = number_leaf_cells >= total_leaf_cells/size-1;
+  passed &= number_leaf_cells <= (total_leaf_cells/size+2);
+
+  // Check if cell data is valid (value==level)
+  if (iterator.toOwnedBegin())
+    do {
+      passed &= iterator.getCell()->getCellData().getValue() == iterator.getCell()->getLevel();
+    } while (iterator.ownedNext());
+
+  // Only the leaf cells hold data
+  tree.applyToAllCells([&passed](const std::shared_ptr<Cell2D> &cell, const unsigned) {
+    passed &= cell->hasCellData() == cell->isLeaf();
+  });
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
+
 // Small load balancing (one root)
 // Mesh at min level 2 then split the first child cell until max level 3
 // X show the leaf cells that belong to each process
@@ -489,3 +575,146 @@ TEST_CASE("[core][manager][balance][mpi] Small load balancing (two roots)") {
   // Final check
   CHECK(all_passed);
 }
+
+// Load balancing (empty partitions, fields)
+// Mesh at level 3 on process 1 and all other process have empty partitions
+// Set a field value as the cell level then load balance between process
+// All process then check if the field values moved with the cells
+TEST_CASE("[core][manager][balance][mpi] Load balancing (empty partitions, fields)") {
+  using Cell2D = Cell<2,2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell2D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell2D> eA{A};
+  std::vector<RootCellEntry<Cell2D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{2}, max_level{3};
+  Tree<Cell2D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+
+  // Split some cells to level 3 in process 1
+  const unsigned owner = size > 1 ? 1 : 0;
+  if (rank == owner) {
+    for (const auto &child : A->getChildCells())
+      child->split(max_level);
+    for (const auto &child : A->getChildCells())
+      child->getChildCell(0)->split(max_level);
+    A->setToThisProcRecurs();
+  } else
+    A->setToOtherProcRecurs();
+
+  // Field value set as the cell level
+  tree.addField("level");
+  auto level = tree.getField("level");
+  tree.applyToOwnedLeaves([&level](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+    level[index] = cell->getLevel();
+  });
+
+  // The parallel meshing at min level cannot keep the fields
+  bool passed = true;
+  if (size > 1) {
+    bool exception_thrown = false;
+    try {
+      tree.meshAtMinLevel();
+    } catch (const std::exception &e) {
+      exception_thrown = true;
+    }
+    passed &= exception_thrown;
+  }
+
+  // Load balance the tree
+  tree.loadBalance();
+
+  // Field values should follow the cells
+  passed &= tree.getField("level").size() == tree.countOwnedLeaves();
+  level = tree.getField("level");
+  tree.applyToOwnedLeaves([&level, &passed](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+    passed &= level[index] == cell->getLevel();
+  });
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
+
+// Load balancing (empty partitions, adaptation log)
+// Mesh at level 3 on process 1 and all other process have empty partitions
+// Load balance between process with the adaptation log enabled
+// The owner process sends a range to every other process and the other processes receive all their leaves from it
+TEST_CASE("[core][manager][balance][mpi] Load balancing (empty partitions, adaptation log)") {
+  using Cell2D = Cell<2,2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell2D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell2D> eA{A};
+  std::vector<RootCellEntry<Cell2D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{2}, max_level{3};
+  Tree<Cell2D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+  tree.enableAdaptationLog();
+
+  // Split some cells to level 3 in process 1
+  const unsigned owner = size > 1 ? 1 : 0;
+  if (rank == owner) {
+    for (const auto &child : A->getChildCells())
+      child->split(max_level);
+    for (const auto &child : A->getChildCells())
+      child->getChildCell(0)->split(max_level);
+    A->setToThisProcRecurs();
+  } else
+    A->setToOtherProcRecurs();
+  const unsigned old_number_leaves = tree.countOwnedLeaves();
+
+  // Load balance the tree
+  tree.loadBalance();
+  const auto &log = tree.getAdaptationLog();
+  std::vector<unsigned> new_counts;
+  scalarAllgather<unsigned>(tree.countOwnedLeaves(), new_counts, size);
+
+  bool passed = std::is_sorted(log.getCreatedFamilies().begin(), log.getCreatedFamilies().end());
+  if (rank == owner) {
+    // One range sent to each process with leaves, along the SFC
+    passed &= log.getReceivedRanges().empty();
+    unsigned number_sent{0}, number_ranges{0};
+    for (const auto &range : log.getSentRanges()) {
+      passed &= range.rank != owner && range.number_leaves == new_counts[range.rank];
+      // Ranges before the owner partition start at the beginning, those after it follow the kept leaves
+      passed &= range.first == (range.rank < owner ? number_sent : number_sent + new_counts[owner]);
+      number_sent += range.number_leaves;
+      ++number_ranges;
+    }
+    passed &= number_sent + new_counts[owner] == old_number_leaves;
+    for (unsigned p{0}; p<size; ++p)
+      number_ranges -= p != owner && new_counts[p] > 0;
+    passed &= number_ranges == 0;
+  } else {
+    // All the leaves received from the owner process
+    passed &= log.getSentRanges().empty();
+    const auto &ranges = log.getReceivedRanges();
+    if (new_counts[rank] > 0)
+      passed &= ranges.size() == 1 && ranges[0].rank == owner && ranges[0].first == 0 && ranges[0].number_leaves == new_counts[rank];
+    else
+      passed &= ranges.empty();
+  }
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
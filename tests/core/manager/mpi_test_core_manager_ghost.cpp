@@ -65,6 +65,13 @@ TEST_CASE("[core][manager][ghost][mpi] 1D Ghost Cells creation (one root, 1D)")
     passed &= !A->getChildCell(otherRank)->isLeaf();
     // Check value
     passed &= A->getChildCell(otherRank)->getChildCell(rank)->getCellData().getValue() == (2*otherRank+rank);
+
+    // Ghost cells created by the ghost layer are listed in their level
+    std::vector<Cell1D*> owned_cells, ghost_cells;
+    tree.applyToLevel(2, [&owned_cells](const std::shared_ptr<Cell1D> &cell, const unsigned) { owned_cells.push_back(cell.get()); });
+    tree.applyToLevel(2, [&ghost_cells](const std::shared_ptr<Cell1D> &cell, const unsigned) { ghost_cells.push_back(cell.get()); }, true);
+    passed &= owned_cells == std::vector<Cell1D*>({ A->getChildCell(rank)->getChildCell(0).get(), A->getChildCell(rank)->getChildCell(1).get() });
+    passed &= ghost_cells == std::vector<Cell1D*>({ A->getChildCell(otherRank)->getChildCell(0).get(), A->getChildCell(otherRank)->getChildCell(1).get() });
   }
 
   // Test should pass on all processes
@@ -177,3 +184,289 @@ TEST_CASE("[core][manager][ghost][mpi] 1D Ghost Cells leading to extrapolate con
   // Final check
   CHECK(all_passed);
 }
+
+namespace core::manager::ghost {
+// Cell data only held by leaf cells
+class LeafOnlyCellData : public CellData {};
+}
+
+template<>
+struct CellDataTraits<core::manager::ghost::LeafOnlyCellData> : CellDataTraits<CellData> {
+  static constexpr bool leaf_only = true;
+};
+
+// 1D ghost cells with data only held by leaf cells (one root, 1D)
+// Same structure as above: cell Z of process 1 is sent and split while creating ghost cells, it keeps its data until
+// the value is sent and extrapolated, then only the leaf cells hold data in both processes
+TEST_CASE("[core][manager][ghost][mpi] 1D Ghost Cells with leaf-only data (one root, 1D)") {
+  using Cell1D = Cell<2, 0, 0, core::manager::ghost::LeafOnlyCellData>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell1D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell1D> eA{A};
+  std::vector<RootCellEntry<Cell1D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{1}, max_level{3};
+  Tree<Cell1D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+
+  // Create the tree structure
+  A->setToOtherProcRecurs();
+  if (rank == 0)  {
+    A->setToThisProc();
+    A->getChildCell(0)->split(max_level);
+    A->getChildCell(0)->getChildCell(1)->split(max_level);
+    A->getChildCell(0)->setToThisProcRecurs();
+    A->getChildCell(0)->getChildCell(1)->getChildCell(1)->getCellData().setValue(rank);
+  }
+  if (rank == 1)  {
+    A->setToThisProc();
+    A->getChildCell(1)->setToThisProcRecurs();
+    A->getChildCell(1)->getCellData().setValue(rank);
+  }
+
+  // Only the leaf cells hold data and no cell keeps it when split
+  const auto leaf_only = [&tree]() {
+    bool valid = true;
+    tree.applyToAllCells([&valid](const std::shared_ptr<Cell1D> &cell, const unsigned) {
+      valid &= cell->hasCellData() == cell->isLeaf() && !cell->keepsCellData();
+    });
+    return valid;
+  };
+  bool passed = leaf_only();
+
+  // Create ghost cells (cell Z keeps its data while split)
+  Tree<Cell1D>::GhostManagerTaskType task = tree.buildGhostLayer();
+  passed &= size==1 || !task.is_finished;
+  if (rank == 1 && size > 1)
+    passed &= !A->getChildCell(1)->isLeaf() && A->getChildCell(1)->hasCellData() && !A->getChildCell(1)->keepsCellData();
+
+  // Exchange ghost values and extrapolate them to the child cells
+  auto copyInterpolationFunction = [](const std::shared_ptr<Cell1D> &parent_cell) -> bool {
+    for (const auto &child : parent_cell->getChildCells())
+      child->getCellData().setValue(parent_cell->getCellData().getValue());
+    return true;
+  };
+  task.setOwnedExtrapolationFunction(copyInterpolationFunction);
+  task.setGhostExtrapolationFunction(copyInterpolationFunction);
+  task.setOwnedConflictResolutionStrategy({ OwnedConflictResolutionStrategy::EXTRAPOLATE });
+  task.setGhostConflictResolutionStrategy({ GhostConflictResolutionStrategy::EXTRAPOLATE });
+  tree.exchangeGhostValues(task);
+  passed &= task.is_finished;
+
+  // Values extrapolated to the leaf cells and data released from the split cells
+  if (rank == 0 && size > 1)
+    passed &= !A->getChildCell(1)->isLeaf() && A->getChildCell(1)->getChildCell(0)->getCellData().getValue() == 1;
+  if (rank == 1 && size > 1) {
+    passed &= A->getChildCell(0)->getChildCell(1)->getChildCell(1)->getCellData().getValue() == 0;
+    passed &= A->getChildCell(1)->getChildCell(0)->getCellData().getValue() == rank;
+  }
+  passed &= leaf_only();
+
+  // Splitting a boundary cell again releases its data
+  if (rank == 1 && size > 1) {
+    A->getChildCell(1)->getChildCell(0)->split(max_level);
+    passed &= !A->getChildCell(1)->getChildCell(0)->hasCellData();
+  }
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
+
+// 1D ghost cells splitting owned cells with fields registered (one root, 1D)
+// Same structure as above without balancing first: cell Z of process 1 is split by the ghost cell creation and the
+// fields are remapped to the new owned leaves (child cells take the parent value)
+TEST_CASE("[core][manager][ghost][mpi] 1D Ghost Cells splitting owned cells with fields (one root, 1D)") {
+  using Cell1D = Cell<2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell1D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell1D> eA{A};
+  std::vector<RootCellEntry<Cell1D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{1}, max_level{3};
+  Tree<Cell1D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+
+  // Create the tree structure
+  A->setToOtherProcRecurs();
+  if (rank == 0)  {
+    A->setToThisProc();
+    A->getChildCell(0)->split(max_level);
+    A->getChildCell(0)->getChildCell(1)->split(max_level);
+    A->getChildCell(0)->setToThisProcRecurs();
+  }
+  if (rank == 1)  {
+    A->setToThisProc();
+    A->getChildCell(1)->setToThisProcRecurs();
+  }
+  tree.updateOwnedRoots();
+
+  // Field value set as the rank
+  tree.addField("rank");
+  auto field = tree.getField("rank");
+  for (double &value : field)
+    value = rank;
+
+  // Create ghost cells
+  Tree<Cell1D>::GhostManagerTaskType task = tree.buildGhostLayer();
+  (void)task;
+
+  // The field follows the owned leaves
+  field = tree.getField("rank");
+  bool passed = field.size() == tree.countOwnedLeaves();
+  for (const double value : field)
+    passed &= value == rank;
+  if (rank == 1 && size > 1)
+    passed &= !A->getChildCell(1)->isLeaf() && field.size() == 2;
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
+
+// 1D 2:1 balance across the partition boundary before creating ghost cells (one root, 1D)
+// Same structure as above: the balance splits cell Z of process 1 (values extrapolated) so that the ghost layer
+// creation does not lead to conflicts
+//                              rank 1
+//                │       │       │       │       │
+// structure  ->  │       │   │   │   Z   │   Z   │
+//                └───────┴───┴───┴───────┴───────┘
+TEST_CASE("[core][manager][ghost][mpi] 1D balance before ghost cells creation (one root, 1D)") {
+  using Cell1D = Cell<2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell1D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell1D> eA{A};
+  std::vector<RootCellEntry<Cell1D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{1}, max_level{3};
+  Tree<Cell1D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+
+  // Create the tree structure
+  A->setToOtherProcRecurs();
+  if (rank == 0)  {
+    A->setToThisProc();
+    A->getChildCell(0)->split(max_level);
+    A->getChildCell(0)->getChildCell(1)->split(max_level);
+    A->getChildCell(0)->setToThisProcRecurs();
+    A->getChildCell(0)->getChildCell(1)->getChildCell(1)->getCellData().setValue(rank);
+  }
+  if (rank == 1)  {
+    A->setToThisProc();
+    A->getChildCell(1)->setToThisProcRecurs();
+    A->getChildCell(1)->getCellData().setValue(rank);
+  }
+  tree.updateOwnedRoots();
+
+  // Balance the mesh across the partition boundary (child cells take the parent value)
+  const unsigned number_rounds = tree.balanceLevels([](const std::shared_ptr<Cell1D> &parent_cell) {
+    for (const auto &child : parent_cell->getChildCells())
+      child->getCellData().setValue(parent_cell->getCellData().getValue());
+  });
+  bool passed = size==1 || number_rounds>0;
+
+  // Cell Z is split in process 1
+  if (rank == 1) {
+    passed &= !A->getChildCell(1)->isLeaf();
+    passed &= tree.countOwnedLeaves() == 2;
+    if (!A->getChildCell(1)->isLeaf())
+      passed &= A->getChildCell(1)->getChildCell(0)->getCellData().getValue() == rank;
+  }
+  if (rank == 0)
+    passed &= tree.countOwnedLeaves() == 3;
+
+  // No conflict when creating ghost cells
+  Tree<Cell1D>::GhostManagerTaskType task = tree.buildGhostLayer();
+  passed &= task.is_finished;
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
+
+// 2D 2:1 balance across the partition boundary (brick of 2x1 roots, one root per process)
+// Process 0 refines the cells of root A along root B down to level 4, the balance ripples through root B in process 1
+// which ends with the same mesh as a serial tree
+TEST_CASE("[core][manager][ghost][mpi] 2D balance across the partition boundary (two roots)") {
+  using Cell2D = Cell<2,2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+  unsigned min_level{1}, max_level{5};
+
+  // Refine the cells of root A along root B
+  auto refine_along_b = [&](const std::shared_ptr<Cell2D> &root_a) {
+    std::shared_ptr<Cell2D> cell = root_a->getChildCell(1);
+    while (cell->getLevel()<max_level-1) {
+      cell->split(max_level);
+      cell = cell->getChildCell(1);
+    }
+  };
+
+  // Serial reference
+  Tree<Cell2D> serial_tree(min_level, max_level);
+  serial_tree.createBrickRootCells({2, 1});
+  refine_along_b(serial_tree.getRootCells()[0]);
+
+  // Parallel tree with root A in process 0 and root B in process 1
+  Tree<Cell2D> tree(min_level, max_level, rank, size);
+  tree.createBrickRootCells({2, 1});
+  const auto &root_cells = tree.getRootCells();
+  for (const auto &root_cell : root_cells)
+    root_cell->setToOtherProcRecurs();
+  if (rank<2 && size>1)
+    root_cells[rank]->setToThisProcRecurs();
+  if (size == 1)
+    for (const auto &root_cell : root_cells)
+      root_cell->setToThisProcRecurs();
+  tree.updateOwnedRoots();
+  if (rank == 0)
+    refine_along_b(root_cells[0]);
+
+  tree.balanceLevels();
+
+  // Owned roots have the mesh of the serial tree
+  bool passed = true;
+  for (unsigned i{0}; i<2; ++i)
+    if (root_cells[i]->belongToThisProc())
+      passed &= root_cells[i]->countLeaves() == serial_tree.getRootCells()[i]->countLeaves();
+  if (rank == 1)
+    passed &= root_cells[1]->countLeaves() > 4;
+
+  // No conflict when creating ghost cells
+  Tree<Cell2D>::GhostManagerTaskType task = tree.buildGhostLayer();
+  passed &= task.is_finished;
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
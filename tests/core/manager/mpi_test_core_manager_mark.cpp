@@ -0,0 +1,104 @@
+#include <doctest.h>
+
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/RootCellEntry.h>
+#include <core/Tree.h>
+#include <parallel/allgather.h>
+#include <parallel/allreduce.h>
+
+// Marking strategies (distributed leaves)
+// Mesh at level 4 on process 1 then load balance between process
+// The error of a leaf is its global SFC position plus one, so the flags are known from the global positions
+TEST_CASE("[core][manager][mark][mpi] Marking strategies (distributed leaves)") {
+  using Cell2D = Cell<2,2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Create root cell
+  auto A = std::make_shared<Cell2D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell2D> eA{A};
+  std::vector<RootCellEntry<Cell2D>> entries { eA };
+
+  // Construction of the tree
+  unsigned min_level{1}, max_level{5};
+  Tree<Cell2D> tree(min_level, max_level, rank, size);
+  tree.createRootCells(entries);
+
+  // Split all the cells to level 4 in process 1
+  const unsigned owner = size > 1 ? 1 : 0;
+  if (rank == owner) {
+    A->setToThisProcRecurs();
+    tree.updateOwnedRoots();
+    for (unsigned level{1}; level<4; ++level) {
+      tree.applyToOwnedLeaves([](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+        (void)index;
+        cell->setToRefine();
+      });
+      tree.refine();
+    }
+  } else
+    A->setToOtherProcRecurs();
+  tree.updateOwnedRoots();
+
+  // Load balance the tree
+  tree.loadBalance();
+
+  // Global SFC position of the first owned leaf
+  std::vector<unsigned> counts;
+  scalarAllgather<unsigned>(tree.countOwnedLeaves(), counts, size);
+  unsigned offset{0}, number_leaves{0};
+  for (unsigned p{0}; p<size; ++p) {
+    offset += p < rank ? counts[p] : 0;
+    number_leaves += counts[p];
+  }
+  bool passed = number_leaves == 256;
+
+  std::vector<double> errors(counts[rank]);
+  for (unsigned i{0}; i<errors.size(); ++i)
+    errors[i] = offset + i + 1.;
+  // Check that the leaves at global positions [0, number_coarsen) are coarsened and those at [256-number_refine, 256)
+  // are refined
+  const auto check_flags = [&](const unsigned number_coarsen, const unsigned number_refine, const MarkCounts &counts) {
+    bool flags_passed{true};
+    tree.applyToOwnedLeaves([&](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+      const unsigned position = offset + index;
+      flags_passed &= cell->isToRefine() == (position >= number_leaves - number_refine);
+      flags_passed &= cell->isToCoarse() == (position < number_coarsen);
+    });
+    unsigned number_refine_sum, number_coarsen_sum;
+    scalarSumAllreduce<unsigned>(counts.number_refine, number_refine_sum);
+    scalarSumAllreduce<unsigned>(counts.number_coarsen, number_coarsen_sum);
+    return flags_passed && number_refine_sum == number_refine && number_coarsen_sum == number_coarsen;
+  };
+
+  // Ten percent of the leaves refined and coarsened
+  MarkParameters parameters;
+  parameters.number_rounds = 3;
+  parameters.strategy = MarkStrategy::FIXED_NUMBER;
+  parameters.refine = 0.1;
+  parameters.coarsen = 0.1;
+  passed &= check_flags(25, 26, tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters));
+
+  // Largest errors summing to half of the global error (sum of the 76 largest positions) and smallest ones summing to at
+  // most 5% of it (sum of the 56 smallest positions)
+  parameters.strategy = MarkStrategy::FIXED_FRACTION;
+  parameters.refine = 0.5;
+  parameters.coarsen = 0.05;
+  passed &= check_flags(56, 76, tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters));
+
+  // Leaf budget of 286 leaves (ten splits)
+  parameters.max_leaves = 286;
+  passed &= check_flags(56, 10, tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters));
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
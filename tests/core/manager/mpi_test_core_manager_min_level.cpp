@@ -196,3 +196,43 @@ TEST_CASE("[core][manager][min_level][mpi] Mesh at min level (1 root per process
   // Final check
   CHECK(all_passed);
 }
+
+// Mesh at min level (brick of 2 roots per process)
+// Roots 2*i and 2*i+1 should be the partition of process i
+TEST_CASE("[core][manager][min_level][mpi] Mesh at min level (brick of roots)") {
+  using Cell2D = Cell<2,2>;
+  const unsigned rank = mpi_rank(),
+                 size = mpi_size();
+
+  // Construction of the tree
+  unsigned min_level{1}, max_level{3};
+  Tree<Cell2D> tree(min_level, max_level, rank, size);
+  tree.createBrickRootCells({2*size, 1});
+
+  // Mesh until min level (1)
+  tree.meshAtMinLevel();
+
+  // Roots in the range belong to this process and the others do not
+  const auto &root_cells = tree.getRootCells();
+  const auto owned_roots = tree.getOwnedRoots();
+  bool passed = true;
+  unsigned number_leaf_cells{0};
+  for (unsigned i{0}; i<root_cells.size(); ++i) {
+    passed &= root_cells[i]->belongToThisProc() == (i>=owned_roots.first && i<owned_roots.second);
+    number_leaf_cells += root_cells[i]->countOwnedLeaves();
+  }
+  passed &= tree.countOwnedLeaves() == number_leaf_cells;
+  passed &= owned_roots == std::make_pair(2*rank, 2*rank+2);
+
+  // The sum of all the leaf cells owned should be the number of cells at min level
+  unsigned total_leaf_cells;
+  scalarSumAllreduce<unsigned>(number_leaf_cells, total_leaf_cells);
+  passed &= total_leaf_cells == root_cells.size()*Cell2D::number_children;
+
+  // Test should pass on all processes
+  bool all_passed;
+  boolAndAllreduce(passed, all_passed);
+
+  // Final check
+  CHECK(all_passed);
+}
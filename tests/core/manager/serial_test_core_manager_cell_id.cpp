@@ -1,5 +1,6 @@
 #include <doctest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <vector>
@@ -93,3 +94,80 @@ TEST_CASE("[core][manager][cell_id] Equal size partition computation does not th
 
   CHECK(!exception_thrown);
 }
+
+// Packed cell keys agree with the cell IDs
+template<typename CellType>
+void check_cell_keys() {
+  auto A = std::make_shared<CellType>(nullptr);
+  auto B = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A}, eB{B};
+  eA.setNeighbor(1, B);          // A +x -> B
+  eB.setNeighbor(0, A);          // B -x -> A
+  std::vector<RootCellEntry<CellType>> entries { eA, eB };
+
+  Tree<CellType> tree(1, 3);
+  tree.createRootCells(entries);
+  A->getChildCell(1)->split(tree.getMaxLevel());
+  A->getChildCell(1)->getChildCell(0)->split(tree.getMaxLevel());
+  B->getChildCell(CellType::number_children-1)->split(tree.getMaxLevel());
+
+  MortonIterator<CellType> iterator(tree.getRootCells(), tree.getMaxLevel());
+  const auto cell_id_manager = iterator.getCellIdManager();
+  CHECK(cell_id_manager.getCellKeySize() < cell_id_manager.getCellIdSize());
+
+  std::vector<std::shared_ptr<CellType>> cells = { A, B };
+  tree.applyToAllCells([&cells](const std::shared_ptr<CellType> &cell, const unsigned) { cells.push_back(cell); });
+
+  std::vector<unsigned> words;
+  for (const auto &cell_1 : cells) {
+    const auto id_1 = iterator.getCellId(cell_1);
+    const auto key_1 = iterator.getCellKey(cell_1);
+    CHECK(cell_id_manager.keyToId(key_1) == id_1);
+    CHECK(cell_id_manager.idToKey(id_1) == key_1);
+    words.clear();
+    cell_id_manager.appendKeyWords(key_1, words);
+    CHECK(cell_id_manager.wordsToKey(words.data()) == key_1);
+    if (!cell_1->isLeaf())
+      for (unsigned order{0}; order<CellType::number_children; ++order)
+        CHECK(cell_id_manager.parentKey(cell_id_manager.childKey(key_1, order)) == key_1);
+
+    for (const auto &cell_2 : cells) {
+      const auto id_2 = iterator.getCellId(cell_2);
+      const auto key_2 = iterator.getCellKey(cell_2);
+      CHECK(cell_id_manager.cellKeyGt(key_1, key_2) == cell_id_manager.cellIdGt(id_1, id_2));
+      CHECK(cell_id_manager.cellKeyGte(key_1, key_2) == cell_id_manager.cellIdGte(id_1, id_2));
+      CHECK(cell_id_manager.cellKeyLt(key_1, key_2) == cell_id_manager.cellIdLt(id_1, id_2));
+      CHECK(cell_id_manager.cellKeyLte(key_1, key_2) == cell_id_manager.cellIdLte(id_1, id_2));
+
+      // Common ancestor level from the order paths
+      const auto order_path_1 = cell_id_manager.keyToOrderPath(key_1);
+      const auto order_path_2 = cell_id_manager.keyToOrderPath(key_2);
+      int common_level{-1};
+      while (common_level+1 < static_cast<int>(std::min(order_path_1.size(), order_path_2.size())) && order_path_1[common_level+1] == order_path_2[common_level+1])
+        ++common_level;
+      CHECK(cell_id_manager.commonAncestorLevel(key_1, key_2) == common_level);
+
+      // Seek from one cell to the other
+      iterator.toCellKey(key_1);
+      iterator.seekCellKey(key_2);
+      CHECK(iterator.getCellPtr() == cell_2.get());
+      CHECK(iterator.getCellKey() == key_2);
+      CHECK(iterator.getCellId() == id_2);
+    }
+  }
+
+  // The iterator key follows the moves
+  iterator.toBegin();
+  do {
+    CHECK(iterator.getCellKey() == iterator.getCellKey(iterator.getCellPtr()));
+    CHECK(iterator.getCellId() == iterator.getCellId(iterator.getCellPtr()));
+  } while (iterator.next());
+}
+
+TEST_CASE("[core][manager][cell_id] Packed cell keys agree with cell IDs (2x2)") {
+  check_cell_keys<Cell<2,2>>();
+}
+
+TEST_CASE("[core][manager][cell_id] Packed cell keys agree with cell IDs (3x2)") {
+  check_cell_keys<Cell<3,2>>();
+}
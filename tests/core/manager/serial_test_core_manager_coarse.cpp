@@ -1,12 +1,15 @@
 #include <doctest.h>
 
+#include <atomic>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include <core/Cell.h>
 #include <core/Tree.h>
 #include <core/RootCellEntry.h>
+#include <parallel/WorkStealingPool.h>
 
 // Coarsen and count number of leaf cells (one root)
 //  ┌───────────────┬───────┬───────┐          ┌───────────────┬───────┬───────┐
@@ -138,3 +141,57 @@ TEST_CASE("[core][manager][coarsen] Coarsen tree (two roots, serial)") {
   // Verify that number of leaf cells is right
   CHECK(number_leaf_cells == 11);
 }
+
+// Coarsening on a thread pool gives the same mesh as the serial coarsening (brick of 2x2 roots refined to level 4, the
+// leaves of a disk are flagged so that the families inside it are coarsened and the ones near its border are kept by the
+// 2:1 balance)
+TEST_CASE("[core][manager][coarsen] Coarsen tree on a thread pool (serial)") {
+  using Cell2D = Cell<2,2>;
+  unsigned min_level{1}, max_level{5};
+
+  // Split all the leaves down to level 4 and flag the leaves of the disk
+  std::function<void(const std::shared_ptr<Cell2D>&, const double, const double, const double)> refine_and_flag =
+    [&](const std::shared_ptr<Cell2D> &cell, const double x, const double y, const double size) {
+    if (cell->getLevel() < max_level-1) {
+      if (cell->isLeaf())
+        cell->split(max_level);
+      for (unsigned i{0}; i<Cell2D::number_children; ++i)
+        refine_and_flag(cell->getChildCell(i), x + (i%2)*size/2, y + (i/2)*size/2, size/2);
+    } else if ((x+size/2-1.)*(x+size/2-1.) + (y+size/2-1.)*(y+size/2-1.) < 0.5)
+      cell->setToCoarse();
+  };
+  auto build_tree = [&](Tree<Cell2D> &tree) {
+    tree.createBrickRootCells({2, 2});
+    const auto &root_cells = tree.getRootCells();
+    for (unsigned i{0}; i<root_cells.size(); ++i)
+      refine_and_flag(root_cells[i], i%2, i/2, 1.);
+  };
+  Tree<Cell2D> tree(min_level, max_level), pool_tree(min_level, max_level);
+  build_tree(tree);
+  build_tree(pool_tree);
+
+  // Coarsen the trees (number of interpolated families)
+  unsigned number_interpolated{0};
+  std::atomic<unsigned> number_pool_interpolated{0};
+  CHECK(tree.coarsen([&number_interpolated](const std::shared_ptr<Cell2D> &cell) { (void)cell; ++number_interpolated; }));
+  WorkStealingPool pool(4);
+  CHECK(pool_tree.coarsen([&number_pool_interpolated](const std::shared_ptr<Cell2D> &cell) { (void)cell; ++number_pool_interpolated; }, pool));
+
+  // Same mesh on both trees
+  std::function<bool(const Cell2D*, const Cell2D*)> same_mesh = [&](const Cell2D *cell, const Cell2D *pool_cell) {
+    if (cell->isLeaf() != pool_cell->isLeaf())
+      return false;
+    if (!cell->isLeaf())
+      for (unsigned i{0}; i<Cell2D::number_children; ++i)
+        if (!same_mesh(cell->getChildCell(i).get(), pool_cell->getChildCell(i).get()))
+          return false;
+    return true;
+  };
+  bool same{true};
+  for (unsigned i{0}; i<4; ++i)
+    same = same && same_mesh(tree.getRootCells()[i].get(), pool_tree.getRootCells()[i].get());
+  CHECK(same);
+  CHECK(number_interpolated == number_pool_interpolated.load());
+  CHECK(tree.countOwnedLeaves() == pool_tree.countOwnedLeaves());
+  CHECK(tree.countOwnedLeaves() < 4*256);
+}
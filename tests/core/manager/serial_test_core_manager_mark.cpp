@@ -0,0 +1,208 @@
+#include <doctest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/Tree.h>
+#include <core/RootCellEntry.h>
+#include <parallel/WorkStealingPool.h>
+
+// Refine uniformly all the owned leaves a number of times
+template<typename TreeType>
+void refineUniformly(TreeType &tree, const unsigned number_times) {
+  using CellType = typename TreeType::CellType;
+  for (unsigned i{0}; i<number_times; ++i) {
+    tree.applyToOwnedLeaves([](const std::shared_ptr<CellType> &cell, const unsigned index) {
+      (void)index;
+      cell->setToRefine();
+    });
+    tree.refine();
+  }
+}
+
+// Marking strategies on 16 leaves at level 4 with errors 1 to 16 along the SFC
+TEST_CASE("[core][manager][mark] Marking strategies (1D, serial)") {
+  using Cell1D = Cell<2>;
+  auto A = std::make_shared<Cell1D>(nullptr);
+  std::vector<RootCellEntry<Cell1D>> entries { RootCellEntry<Cell1D>{A} };
+
+  Tree<Cell1D> tree(1, 6);
+  tree.createRootCells(entries);
+  refineUniformly(tree, 3);
+  CHECK(tree.countOwnedLeaves() == 16);
+  std::vector<double> errors(16);
+  for (unsigned i{0}; i<errors.size(); ++i)
+    errors[i] = i + 1.;
+
+  // Flags of the leaves along the SFC (1 to refine, 2 to coarsen)
+  const auto flags = [&tree]() {
+    std::vector<int> leaf_flags;
+    tree.applyToOwnedLeaves([&leaf_flags](const std::shared_ptr<Cell1D> &cell, const unsigned index) {
+      (void)index;
+      leaf_flags.push_back(cell->isToRefine() ? 1 : (cell->isToCoarse() ? 2 : 0));
+    });
+    return leaf_flags;
+  };
+  const auto expected = [](const unsigned number_coarsen, const unsigned number_refine) {
+    std::vector<int> leaf_flags(16, 0);
+    for (unsigned i{0}; i<number_coarsen; ++i)
+      leaf_flags[i] = 2;
+    for (unsigned i{0}; i<number_refine; ++i)
+      leaf_flags[15-i] = 1;
+    return leaf_flags;
+  };
+
+  // A quarter of the leaves refined and coarsened
+  MarkParameters parameters;
+  parameters.number_rounds = 3;
+  parameters.strategy = MarkStrategy::FIXED_NUMBER;
+  parameters.refine = 0.25;
+  parameters.coarsen = 0.25;
+  MarkCounts counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  CHECK(counts.number_refine == 4);
+  CHECK(counts.number_coarsen == 4);
+  CHECK(flags() == expected(4, 4));
+
+  // Largest errors summing to 30% of 136 (16+15+14) and smallest ones summing to at most 10% of it (1+2+3+4)
+  parameters.strategy = MarkStrategy::FIXED_FRACTION;
+  parameters.refine = 0.3;
+  parameters.coarsen = 0.1;
+  counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  CHECK(counts.number_refine == 3);
+  CHECK(counts.number_coarsen == 4);
+  CHECK(flags() == expected(4, 3));
+
+  // Error values
+  parameters.strategy = MarkStrategy::THRESHOLD;
+  parameters.refine = 14.;
+  parameters.coarsen = 2.5;
+  counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  CHECK(counts.number_refine == 3);
+  CHECK(counts.number_coarsen == 2);
+  CHECK(flags() == expected(2, 3));
+
+  // Leaf budget of 18 leaves (two splits) and errors from a field
+  tree.addField("error");
+  auto error_field = tree.getField("error");
+  std::copy(errors.begin(), errors.end(), error_field.begin());
+  parameters.strategy = MarkStrategy::FIXED_NUMBER;
+  parameters.refine = 0.5;
+  parameters.coarsen = 0.;
+  parameters.max_leaves = 18;
+  counts = tree.markField("error", parameters);
+  CHECK(counts.number_refine == 2);
+  CHECK(counts.number_coarsen == 0);
+  CHECK(flags() == expected(0, 2));
+  CHECK(tree.refine());
+  CHECK(tree.countOwnedLeaves() == 18);
+
+  // Nothing refined once the budget is reached
+  counts = tree.markLeaves([](const std::shared_ptr<Cell1D> &cell) { return 1. + cell->getLevel(); }, parameters);
+  CHECK(counts.number_refine == 0);
+
+  bool exception_thrown{false};
+  try {
+    tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters); // one error per leaf expected
+  } catch (const std::runtime_error&) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+}
+
+// Fixed number marking of random errors on a thread pool (2D)
+TEST_CASE("[core][manager][mark] Marking on a thread pool (2D, serial)") {
+  using Cell2D = Cell<2,2>;
+  auto A = std::make_shared<Cell2D>(nullptr);
+  std::vector<RootCellEntry<Cell2D>> entries { RootCellEntry<Cell2D>{A} };
+
+  Tree<Cell2D> tree(1, 8);
+  tree.createRootCells(entries);
+  refineUniformly(tree, 5);
+  const unsigned number_leaves = tree.countOwnedLeaves();
+  CHECK(number_leaves == 4096);
+
+  // Random errors along the SFC
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0., 1.);
+  std::vector<double> errors(number_leaves);
+  for (double &error : errors)
+    error = distribution(generator);
+
+  // A single round (default) places the thresholds on power of two bins: more leaves refined, fewer coarsened
+  MarkParameters parameters;
+  parameters.strategy = MarkStrategy::FIXED_NUMBER;
+  parameters.refine = 0.1;
+  parameters.coarsen = 0.2;
+  const MarkCounts single_round_counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  CHECK(single_round_counts.number_refine >= static_cast<std::size_t>(std::ceil(0.1*number_leaves)));
+  CHECK(single_round_counts.number_coarsen <= static_cast<std::size_t>(std::floor(0.2*number_leaves)));
+
+  parameters.number_rounds = 3;
+  const MarkCounts counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  // The thresholds are narrowed down to bins holding a single leaf
+  CHECK(counts.number_refine == static_cast<std::size_t>(std::ceil(0.1*number_leaves)));
+  CHECK(counts.number_coarsen == static_cast<std::size_t>(std::floor(0.2*number_leaves)));
+  std::vector<bool> refine_flags, coarsen_flags;
+  tree.applyToOwnedLeaves([&](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+    (void)index;
+    refine_flags.push_back(cell->isToRefine());
+    coarsen_flags.push_back(cell->isToCoarse());
+  });
+
+  // Same flags with the errors computed and the leaves flagged on a thread pool
+  std::unordered_map<const Cell2D*, double> cell_errors;
+  tree.applyToOwnedLeaves([&cell_errors, &errors](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+    cell_errors[cell.get()] = errors[index];
+  });
+  WorkStealingPool pool(4);
+  const MarkCounts pool_counts = tree.markLeaves([&cell_errors](const std::shared_ptr<Cell2D> &cell) {
+    return cell_errors.at(cell.get());
+  }, parameters, pool);
+  CHECK(pool_counts.number_refine == counts.number_refine);
+  CHECK(pool_counts.number_coarsen == counts.number_coarsen);
+  bool same_flags{true};
+  tree.applyToOwnedLeaves([&](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+    same_flags &= cell->isToRefine() == refine_flags[index] && cell->isToCoarse() == coarsen_flags[index];
+  });
+  CHECK(same_flags);
+}
+
+// Fixed fraction marking when the leaves at max level hold most of the error (1D)
+//
+//                │               A               │
+// structure  ->  └───────────────┴───────┴───┴───┘
+// errors     ->          0           e     10  10
+TEST_CASE("[core][manager][mark] Fixed fraction with the error at max level (1D, serial)") {
+  using Cell1D = Cell<2>;
+  auto A = std::make_shared<Cell1D>(nullptr);
+  std::vector<RootCellEntry<Cell1D>> entries { RootCellEntry<Cell1D>{A} };
+
+  Tree<Cell1D> tree(1, 3);
+  tree.createRootCells(entries);
+  A->getChildCell(1)->split(tree.getMaxLevel());
+  A->getChildCell(1)->getChildCell(1)->split(tree.getMaxLevel());
+  CHECK(tree.countOwnedLeaves() == 4);
+
+  // Leaves without error are not refined even if the target cannot be reached
+  MarkParameters parameters;
+  parameters.strategy = MarkStrategy::FIXED_FRACTION;
+  parameters.refine = 0.3;
+  std::vector<double> errors { 0., 0., 10., 10. };
+  MarkCounts counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  CHECK(counts.number_refine == 0);
+  CHECK(!A->getChildCell(0)->isToRefine());
+  CHECK(!A->getChildCell(1)->getChildCell(0)->isToRefine());
+
+  // The fraction is taken over the error of the leaves below max level
+  errors[1] = 1.;
+  counts = tree.markErrors(FieldSpan<const double>(errors.data(), errors.size()), parameters);
+  CHECK(counts.number_refine == 1);
+  CHECK(!A->getChildCell(0)->isToRefine());
+  CHECK(A->getChildCell(1)->getChildCell(0)->isToRefine());
+}
@@ -1,6 +1,7 @@
 #include <doctest.h>
 
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -105,3 +106,90 @@ TEST_CASE("[core][manager][refine] Refine tree (two roots, serial)") {
   // Verify that number of leaf cells is right
   CHECK(number_leaf_cells == 23);
 }
+
+// Bulk refinement of the two roots tree above: same mesh, the cells split for balance are counted
+TEST_CASE("[core][manager][refine] Bulk refine tree (two roots, serial)") {
+  using Cell2D = Cell<2,2>;
+  // Create 2 root cells
+  auto A = std::make_shared<Cell2D>(nullptr);
+  auto B = std::make_shared<Cell2D>(nullptr);
+
+  // Create root cell entries
+  RootCellEntry<Cell2D> eA{A}, eB{B};
+  eA.setNeighbor(1, B);          // A +x -> B
+  eB.setNeighbor(0, A);          // B -x -> A
+  std::vector<RootCellEntry<Cell2D>> entries { eA, eB };
+
+  // Construction of the tree
+  unsigned min_level{1}, max_level{3};
+  Tree<Cell2D> tree(min_level, max_level);
+  tree.createRootCells(entries);
+
+  // Refine the first child cell of root B
+  B->getChildCell(0)->split(tree.getMaxLevel());
+
+  // Set flags for cells to refine
+  B->getChildCell(0)->getChildCell(0)->setToRefine();
+  B->getChildCell(0)->getChildCell(1)->setToRefine();
+
+  // Refine the tree
+  const RefineCounts counts = tree.refineBulk();
+
+  // The second child cells of A and B are split for balance
+  CHECK(counts.number_flagged == 2);
+  CHECK(counts.number_balance == 2);
+  CHECK(A->getChildCell(1)->isLeaf() == false);
+  CHECK(B->getChildCell(1)->isLeaf() == false);
+
+  // Verify that number of leaf cells is right
+  CHECK(A->countLeaves() + B->countLeaves() == 23);
+}
+
+// Bulk refinement with a balance ripple over several levels gives the same mesh as the recursive refinement
+TEST_CASE("[core][manager][refine] Bulk refine tree matches recursive refine (serial)") {
+  using Cell2D = Cell<2,2>;
+  unsigned min_level{1}, max_level{6};
+
+  // Two identical trees of 2x1 roots with a corner cell refined to the finest level
+  auto build_tree = [&](Tree<Cell2D> &tree) {
+    tree.createBrickRootCells({2, 1});
+    Cell2D *cell = tree.getRootCells()[1]->getChildCell(0).get();
+    while (cell->getLevel()<max_level-1) {
+      cell->split(max_level);
+      cell = cell->getChildCell(0).get();
+    }
+    cell->setToRefine();
+  };
+  Tree<Cell2D> tree(min_level, max_level), bulk_tree(min_level, max_level);
+  build_tree(tree);
+  build_tree(bulk_tree);
+
+  tree.refine();
+  const std::size_t number_slabs = bulk_tree.getOctAllocator().getNumberSlabs();
+  const unsigned number_leaves = bulk_tree.countOwnedLeaves();
+  const RefineCounts counts = bulk_tree.refineBulk();
+
+  // Same mesh on both trees
+  std::function<bool(const Cell2D*, const Cell2D*)> same_mesh = [&](const Cell2D *cell, const Cell2D *bulk_cell) {
+    if (cell->isLeaf() != bulk_cell->isLeaf())
+      return false;
+    if (!cell->isLeaf())
+      for (unsigned i{0}; i<Cell2D::number_children; ++i)
+        if (!same_mesh(cell->getChildCell(i).get(), bulk_cell->getChildCell(i).get()))
+          return false;
+    return true;
+  };
+  bool same{true};
+  for (unsigned i{0}; i<2; ++i)
+    same = same && same_mesh(tree.getRootCells()[i].get(), bulk_tree.getRootCells()[i].get());
+  CHECK(same);
+  CHECK(tree.countOwnedLeaves() == bulk_tree.countOwnedLeaves());
+
+  // The split of the finest cell ripples to the coarser levels of both roots
+  CHECK(counts.number_flagged == 1);
+  CHECK(counts.number_balance > 0);
+  CHECK(bulk_tree.countOwnedLeaves() == number_leaves + 3*(counts.number_flagged + counts.number_balance));
+
+  // The octs of the bulk split are taken from at most one new slab
+  CHECK(bulk_tree.getOctAllocator().getNumberSlabs() <= number_slabs + 1);
+}
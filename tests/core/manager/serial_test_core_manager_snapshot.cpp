@@ -120,6 +120,17 @@ class TestCellData : public CellData {
   }
 };
 
+// Cell data only held by leaf cells
+template<int Nx, int Ny, int Nz>
+class LeafOnlyTestCellData : public TestCellData<Nx, Ny, Nz> {};
+}
+
+template<int Nx, int Ny, int Nz>
+struct CellDataTraits<core::manager::snapshot::LeafOnlyTestCellData<Nx, Ny, Nz>> : CellDataTraitsBase {
+  static constexpr bool leaf_only = true;
+};
+
+namespace core::manager::snapshot {
 template<typename CellType>
 void initialize_tree_cells_limits(std::shared_ptr<CellType> cell) {
   if (cell->isLeaf())
@@ -150,6 +161,20 @@ void check_cells_data(std::shared_ptr<CellType> cell, std::shared_ptr<CellType>
   }
 }
 
+template<typename CellType>
+void check_leaf_only_cells_data(std::shared_ptr<CellType> cell, std::shared_ptr<CellType> restored_cell) {
+  CHECK(cell->isLeaf() == restored_cell->isLeaf()); // Both split or both leaves
+  if (cell->isLeaf()) {
+    CHECK(cell->getCellData().isEqual(restored_cell->getCellData()));
+    return;
+  }
+
+  // Only leaf cells hold data
+  CHECK(!restored_cell->hasCellData());
+  for (unsigned n{0}; n<CellType::number_children; ++n)
+    check_leaf_only_cells_data<CellType>(cell->getChildCell(n), restored_cell->getChildCell(n));
+}
+
 void printSnapshotDebug(const std::string& snapshot) {
   const bool binary = snapshot.find("BINARY 1") != std::string::npos;
 
@@ -390,14 +415,14 @@ TEST_CASE("[core][manager][snapshot] Snapshot of a quadtree with 4 root cells (b
        B_restored = restored_tree.getRootCells()[1],
        C_restored = restored_tree.getRootCells()[2],
        D_restored = restored_tree.getRootCells()[3];
-  CHECK(A_restored->getNeighborCell(1) == B_restored);
-  CHECK(A_restored->getNeighborCell(3) == C_restored);
-  CHECK(B_restored->getNeighborCell(0) == A_restored);
-  CHECK(B_restored->getNeighborCell(3) == D_restored);
-  CHECK(C_restored->getNeighborCell(1) == D_restored);
-  CHECK(C_restored->getNeighborCell(2) == A_restored);
-  CHECK(D_restored->getNeighborCell(0) == C_restored);
-  CHECK(D_restored->getNeighborCell(2) == B_restored);
+  CHECK(A_restored->getNeighborCell(1) == B_restored.get());
+  CHECK(A_restored->getNeighborCell(3) == C_restored.get());
+  CHECK(B_restored->getNeighborCell(0) == A_restored.get());
+  CHECK(B_restored->getNeighborCell(3) == D_restored.get());
+  CHECK(C_restored->getNeighborCell(1) == D_restored.get());
+  CHECK(C_restored->getNeighborCell(2) == A_restored.get());
+  CHECK(D_restored->getNeighborCell(0) == C_restored.get());
+  CHECK(D_restored->getNeighborCell(2) == B_restored.get());
 }
 
 // Snapshot of a quadtree with cell data (restore from string)
@@ -491,3 +516,65 @@ TEST_CASE("[core][manager][snapshot] Snapshot of a quadtree with cell data (rest
   core::manager::snapshot::check_cells_data(A, A_restored);
   core::manager::snapshot::check_cells_data(B, B_restored);
 }
+
+// Snapshot of a quadtree where only leaf cells hold data
+//                ┌───┬─┬─┐
+//                │   ├─┼─┤
+// structure  ->  ├─┬─┼─┴─┤
+//                ├─┼─┤   │
+//                └─┴─┴───┘
+TEST_CASE("[core][manager][snapshot] Snapshot of a quadtree with leaf-only cell data") {
+  static constexpr int Nx = 2, Ny = 2, Nz = 0;
+  using Cell2D = Cell<Nx,Ny,Nz, core::manager::snapshot::LeafOnlyTestCellData<Nx, Ny, Nz>>;
+  using QuadTree = Tree<Cell2D>;
+  const auto extrapolate = [](const std::shared_ptr<Cell2D> &cell) {
+    for (unsigned n{0}; n<Cell2D::number_children; ++n)
+      cell->getCellData().extrapolateToChild(cell->getChildCell(n)->getCellData(), n);
+  };
+
+  // Create root cell
+  auto A = std::make_shared<Cell2D>(nullptr);
+  RootCellEntry<Cell2D> eA{A};
+  std::vector<RootCellEntry<Cell2D>> entries { eA };
+
+  // Create the tree (the root cell is split and its data released)
+  unsigned max_level{2};
+  QuadTree tree(1, max_level);
+  tree.createRootCells(entries);
+  CHECK(!A->hasCellData());
+
+  // Set the level 1 cells data and split some cells (data is moved to the child cells)
+  core::manager::snapshot::TestCellData<Nx, Ny, Nz> root_data;
+  root_data.imax = Nx*Nx; root_data.jmax = Ny*Ny;
+  for (unsigned n{0}; n<Cell2D::number_children; ++n)
+    root_data.extrapolateToChild(A->getChildCell(n)->getCellData(), n);
+  A->getChildCell(0)->split(max_level, extrapolate);
+  A->getChildCell(3)->split(max_level, extrapolate);
+  CHECK(!A->getChildCell(0)->hasCellData());
+  CHECK(A->getChildCell(1)->hasCellData());
+  CHECK(A->getChildCell(3)->getChildCell(3)->getCellData().imin == 3);
+  CHECK(A->getChildCell(3)->getChildCell(3)->getCellData().jmax == 4);
+
+  // Only the leaf cells data is dumped
+  SnapshotManager<QuadTree> snapshot_manager(0, 1);
+  std::string snapshot_string = snapshot_manager.dumpMetaAndTreeToString(tree);
+  CHECK(snapshot_string.find("CELL_DATA 10\n") != std::string::npos);
+
+  // Restore the tree from the snapshot string
+  SnapshotManager<QuadTree> restore_manager(0, 1);
+  QuadTree restored_tree = restore_manager.readMetaAndRestoreFromString(snapshot_string);
+  CHECK(10 == restored_tree.countOwnedLeaves());
+  core::manager::snapshot::check_leaf_only_cells_data(A, restored_tree.getRootCells()[0]);
+
+  // Coarsening moves the data back to the parent cell
+  A->getChildCell(3)->coarsen(0, [](const std::shared_ptr<Cell2D> &cell) {
+    auto &cell_data = cell->getCellData();
+    cell_data.imin = cell->getChildCell(0)->getCellData().imin;
+    cell_data.imax = cell->getChildCell(3)->getCellData().imax;
+    cell_data.jmin = cell->getChildCell(0)->getCellData().jmin;
+    cell_data.jmax = cell->getChildCell(3)->getCellData().jmax;
+  });
+  CHECK(A->getChildCell(3)->hasCellData());
+  CHECK(A->getChildCell(3)->getCellData().imin == 2);
+  CHECK(A->getChildCell(3)->getCellData().imax == 4);
+}
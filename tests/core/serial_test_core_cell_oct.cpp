@@ -49,7 +49,7 @@ TEST_CASE("[core][cell_oct] Cell and Oct basic structure") {
   using CellType = Cell<2,2>; // 2D quadtree
   Oct<CellType> oct;
   std::shared_ptr<CellType> dummy_parent = std::make_shared<CellType>();
-  oct.init(dummy_parent, 1);
+  oct.init(dummy_parent.get(), 1);
   auto children = oct.getChildCells();
 
   CHECK(children.size() == CellType::number_children);
@@ -248,3 +248,122 @@ TEST_CASE("[core][cell_oct] Sibling number consistency") {
     CHECK(i == actual_index);
   }
 }
+
+// Test oct block reuse by the tree allocator
+TEST_CASE("[core][cell_oct] Oct allocator reuses coarsened blocks") {
+  using CellType = Cell<2,2>;
+
+  auto A = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A};
+  std::vector<RootCellEntry<CellType>> entries{ eA };
+
+  Tree<CellType> tree(0, 3);
+  tree.createRootCells(entries);
+  const auto &oct_allocator = tree.getOctAllocator();
+
+  // The root oct is created by the allocator in the same block as its children
+  CHECK(oct_allocator.getNumberUsedBlocks() == 1);
+  CHECK(A->getChildCell(0)->getOctAllocator() == &oct_allocator);
+  CHECK(A->getChildCell(0)->getParentOct() == A->getChildOct());
+
+  for (const auto &child : A->getChildCells())
+    child->split(tree.getMaxLevel());
+  CHECK(oct_allocator.getNumberUsedBlocks() == 5);
+  const size_t number_slabs = oct_allocator.getNumberSlabs();
+
+  // Coarsening gives the blocks back to the allocator
+  for (const auto &child : A->getChildCells())
+    CHECK(child->coarsen(tree.getMinLevel()));
+  CHECK(oct_allocator.getNumberUsedBlocks() == 1);
+  const size_t number_free_blocks = oct_allocator.getNumberFreeBlocks();
+
+  // Splitting again reuses the free blocks without new slabs
+  for (const auto &child : A->getChildCells())
+    child->split(tree.getMaxLevel());
+  CHECK(oct_allocator.getNumberUsedBlocks() == 5);
+  CHECK(oct_allocator.getNumberFreeBlocks() == number_free_blocks - 4);
+  CHECK(oct_allocator.getNumberSlabs() == number_slabs);
+  CHECK(A->countLeaves() == 16);
+}
+
+// Test child cell handles kept by a callback across a coarsening
+TEST_CASE("[core][cell_oct] Child cell handles share the oct block") {
+  using CellType = Cell<2,2>;
+
+  auto A = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A};
+  std::vector<RootCellEntry<CellType>> entries{ eA };
+
+  Tree<CellType> tree(0, 3);
+  tree.createRootCells(entries);
+  const auto &oct_allocator = tree.getOctAllocator();
+
+  // Handle stored by an extrapolation callback
+  std::shared_ptr<CellType> stored_cell;
+  A->getChildCell(1)->split(tree.getMaxLevel(), [&stored_cell](const std::shared_ptr<CellType> &cell) {
+    stored_cell = cell->getChildCell(2);
+  });
+  std::weak_ptr<CellType> weak_cell = stored_cell;
+  CHECK(!weak_cell.expired());
+  CHECK(stored_cell == A->getChildCell(1)->getChildCell(2)->thisAsSmartPtr());
+  CHECK(oct_allocator.getNumberUsedBlocks() == 2);
+
+  // The block stays alive while the handle is stored (the cell is cleared)
+  CHECK(A->getChildCell(1)->coarsen(tree.getMinLevel()));
+  CHECK(!weak_cell.expired());
+  CHECK(stored_cell->getParentOct() == nullptr);
+  CHECK(stored_cell->isLeaf());
+  CHECK(oct_allocator.getNumberUsedBlocks() == 2);
+
+  // Then it goes back to the allocator (the weak handle holds the control block stored with it)
+  stored_cell.reset();
+  CHECK(weak_cell.expired());
+  weak_cell.reset();
+  CHECK(oct_allocator.getNumberUsedBlocks() == 1);
+}
+
+// Test the cell header (level, sibling number and root index)
+TEST_CASE("[core][cell_oct] Cell header consistency") {
+  using CellType = Cell<2,2>;
+
+  auto A = std::make_shared<CellType>(nullptr);
+  auto B = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A}, eB{B};
+  eA.setNeighbor(1, B);
+  eB.setNeighbor(0, A);
+  std::vector<RootCellEntry<CellType>> entries{ eA, eB };
+
+  Tree<CellType> tree(0, 3);
+  tree.createRootCells(entries);
+  B->getChildCell(2)->split(tree.getMaxLevel());
+
+  CHECK(A->getRootIndex() == 0);
+  CHECK(B->getRootIndex() == 1);
+  CHECK(A->getLevel() == 0);
+  for (unsigned i{0}; i<CellType::number_children; ++i) {
+    CHECK(A->getChildCell(i)->getRootIndex() == 0);
+    CHECK(B->getChildCell(i)->getRootIndex() == 1);
+    CHECK(B->getChildCell(i)->getLevel() == 1);
+    CHECK(B->getChildCell(i)->getSiblingNumber() == i);
+    CHECK(B->getChildCell(2)->getChildCell(i)->getRootIndex() == 1);
+    CHECK(B->getChildCell(2)->getChildCell(i)->getLevel() == 2);
+    CHECK(B->getChildCell(2)->getChildCell(i)->getSiblingNumber() == i);
+  }
+}
+
+// Test packing of cell data payloads with memcpy
+TEST_CASE("[core][cell_oct] Cell data payload packing") {
+  CHECK(isPackedCellData<CellData>());
+  CHECK(packedCellDataSize<CellData>() == 1);
+
+  CellData data, unpacked_data;
+  data.setValue(3.5);
+  std::vector<double> buffer(packedCellDataSize<CellData>());
+  packCellData(data, buffer.data());
+  unpackCellData(buffer.data(), unpacked_data);
+  CHECK(unpacked_data.getValue() == 3.5);
+
+  // Data types without payload keep the virtual path
+  struct OtherCellData : public CellData {};
+  CHECK(!isPackedCellData<OtherCellData>());
+}
@@ -0,0 +1,165 @@
+#include <doctest.h>
+
+#include <memory>
+#include <vector>
+
+#include <core/Cell.h>
+#include <core/LinearTree.h>
+#include <core/Tree.h>
+#include <core/RootCellEntry.h>
+#include <core/iterator/HilbertIterator.h>
+#include <core/iterator/MortonIterator.h>
+
+// Create a tree of 2 root cells (split at level 1)
+template<typename TreeType>
+std::unique_ptr<TreeType> create_linear_test_tree() {
+  using CellType = typename TreeType::CellType;
+  auto A = std::make_shared<CellType>(nullptr);
+  auto B = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A}, eB{B};
+  eA.setNeighbor(1, B);          // A +x -> B
+  eB.setNeighbor(0, A);          // B -x -> A
+  std::vector<RootCellEntry<CellType>> entries { eA, eB };
+
+  unsigned min_level{1}, max_level{3};
+  auto tree = std::make_unique<TreeType>(min_level, max_level);
+  tree->createRootCells(entries);
+  return tree;
+}
+
+// Check the neighbors found by key arithmetic against the pointer neighbors of the leaves
+template<typename TreeType>
+void check_linear_tree_neighbors(const LinearTree<TreeType> &linear_tree, const std::vector<typename TreeType::CellType*> &leaves) {
+  using CellType = typename TreeType::CellType;
+  std::vector<std::size_t> neighbors;
+  for (std::size_t i{0}; i<linear_tree.size(); ++i)
+    for (unsigned dir{0}; dir<CellType::number_neighbors; ++dir) {
+      linear_tree.getNeighborLeaves(i, dir, neighbors);
+      const CellType *neighbor_cell = leaves[i]->getNeighborCell(dir);
+      if (!neighbor_cell)
+        CHECK(neighbors.empty());
+      else if (neighbor_cell->isLeaf()) {
+        CHECK(neighbors.size() == 1);
+        CHECK(leaves[neighbors[0]] == neighbor_cell);
+      } else {
+        CHECK(neighbors.size() >= 2);
+        for (const std::size_t k : neighbors)
+          CHECK(leaves[k]->getNeighborCell(dir^1) == leaves[i]);
+      }
+    }
+}
+
+// Linear tree of a tree with finer leaves on both sides of the root boundary
+// (the 2:1 balance also splits the left and top-right level 1 cells of A)
+//                ┌───────┬───┬───┐┌───────┬───────┐
+//                │       │   │   ││       │       │
+//                │       ├───┼───┤│       │       │
+//                │       │   │   ││       │       │
+// structure  ->  ├───┬───┼─┬─┼───┤├───┬───┼───────┤
+//                │   │   ├─┼─┤   ││   │   │       │
+//                ├───┼───┼─┴─┼───┤├───┼───┤       │
+//                │   │   │   │   ││   │   │       │
+//                └───┴───┴───┴───┘└───┴───┴───────┘
+template<typename TreeType>
+void check_linear_tree() {
+  using CellType = typename TreeType::CellType;
+  using TreeIteratorType = typename TreeType::TreeIteratorType;
+  auto tree = create_linear_test_tree<TreeType>();
+  const auto &root_cells = tree->getRootCells();
+  root_cells[0]->getChildCell(1)->split(tree->getMaxLevel());
+  root_cells[0]->getChildCell(1)->getChildCell(2)->split(tree->getMaxLevel());
+  root_cells[1]->getChildCell(0)->split(tree->getMaxLevel());
+
+  // Leaves along the SFC
+  std::vector<CellType*> leaves;
+  std::vector<std::vector<unsigned>> index_paths;
+  TreeIteratorType iterator(root_cells, tree->getMaxLevel());
+  iterator.toBegin();
+  do {
+    iterator.getCellPtr()->getCellData().setValue(leaves.size());
+    leaves.push_back(iterator.getCellPtr());
+    index_paths.push_back(iterator.getIndexPath());
+  } while (iterator.next());
+
+  LinearTree<TreeType> linear_tree(*tree);
+  CHECK(linear_tree.size() == 23);
+  CHECK(linear_tree.size() == leaves.size());
+
+  // Keys are increasing and decode to the leaf index paths
+  for (std::size_t i{0}; i<linear_tree.size(); ++i) {
+    if (i>0)
+      CHECK(linear_tree.getKey(i-1) < linear_tree.getKey(i));
+    CHECK(linear_tree.getLevel(i) == leaves[i]->getLevel());
+    CHECK(linear_tree.getIndexPath(i) == index_paths[i]);
+    CHECK(linear_tree.find(linear_tree.getKey(i), linear_tree.getLevel(i)) == i);
+    CHECK(linear_tree.getCellData(i).getValue() == i);
+  }
+
+  // Neighbors found by key arithmetic match the pointer neighbors
+  check_linear_tree_neighbors(linear_tree, leaves);
+
+  // Convert back into a tree with only the root cells split
+  auto new_tree = create_linear_test_tree<TreeType>();
+  linear_tree.toTree(*new_tree);
+  CHECK(new_tree->countOwnedLeaves() == leaves.size());
+  TreeIteratorType new_iterator(new_tree->getRootCells(), new_tree->getMaxLevel());
+  new_iterator.toBegin();
+  std::size_t i{0};
+  do {
+    CHECK(new_iterator.getIndexPath() == index_paths[i]);
+    CHECK(new_iterator.getCellPtr()->getCellData().getValue() == i);
+    ++i;
+  } while (new_iterator.next());
+  CHECK(i == leaves.size());
+}
+
+TEST_CASE("[core][linear_tree] Linear tree keys, neighbors and conversion (Morton)") {
+  using Cell2D = Cell<2,2>;
+  check_linear_tree<Tree<Cell2D, MortonIterator<Cell2D>>>();
+}
+
+TEST_CASE("[core][linear_tree] Linear tree keys, neighbors and conversion (Hilbert)") {
+  using Cell2D = Cell<2,2>;
+  check_linear_tree<Tree<Cell2D, HilbertIterator<Cell2D>>>();
+}
+
+// Linear tree of a 3D tree with finer leaves on both sides of the root boundary (the curve orientations change with
+// the level for the Hilbert curve)
+template<typename TreeType>
+void check_linear_tree_3d() {
+  using CellType = typename TreeType::CellType;
+  using TreeIteratorType = typename TreeType::TreeIteratorType;
+  auto tree = create_linear_test_tree<TreeType>();
+  const auto &root_cells = tree->getRootCells();
+  root_cells[0]->getChildCell(3)->split(tree->getMaxLevel());
+  root_cells[0]->getChildCell(7)->split(tree->getMaxLevel());
+  root_cells[1]->getChildCell(2)->split(tree->getMaxLevel());
+  root_cells[0]->getChildCell(3)->getChildCell(5)->split(tree->getMaxLevel());
+
+  std::vector<CellType*> leaves;
+  std::vector<std::vector<unsigned>> index_paths;
+  TreeIteratorType iterator(root_cells, tree->getMaxLevel());
+  iterator.toBegin();
+  do {
+    leaves.push_back(iterator.getCellPtr());
+    index_paths.push_back(iterator.getIndexPath());
+  } while (iterator.next());
+
+  LinearTree<TreeType> linear_tree(*tree);
+  CHECK(linear_tree.size() == leaves.size());
+  for (std::size_t i{0}; i<linear_tree.size(); ++i) {
+    CHECK(linear_tree.getIndexPath(i) == index_paths[i]);
+    CHECK(linear_tree.find(linear_tree.getKey(i), linear_tree.getLevel(i)) == i);
+  }
+  check_linear_tree_neighbors(linear_tree, leaves);
+}
+
+TEST_CASE("[core][linear_tree] Linear tree neighbors in 3D (Morton)") {
+  using Cell3D = Cell<2,2,2>;
+  check_linear_tree_3d<Tree<Cell3D, MortonIterator<Cell3D>>>();
+}
+
+TEST_CASE("[core][linear_tree] Linear tree neighbors in 3D (Hilbert)") {
+  using Cell3D = Cell<2,2,2>;
+  check_linear_tree_3d<Tree<Cell3D, HilbertIterator<Cell3D>>>();
+}
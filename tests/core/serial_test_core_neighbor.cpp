@@ -745,3 +745,60 @@ TEST_CASE("[core][neighbor] Neighbors search (octree, deep)") {
     }
   );
 }
+
+// Neighbor leaf range (3D)
+// Same structure as above: the range gathers the same neighbor leaf cells as the visitor (null neighbors skipped)
+TEST_CASE("[core][neighbor] Neighbor leaf range (octree)") {
+  using Cell3D = Cell<2,2,2>;
+  auto A = std::make_shared<Cell3D>(nullptr);
+  auto B = std::make_shared<Cell3D>(nullptr);
+  RootCellEntry<Cell3D> eA{A}, eB{B};
+  eA.setNeighbor(1, B);          // A +x -> B
+  eB.setNeighbor(0, A);          // B -x -> A
+  std::vector<RootCellEntry<Cell3D>> entries { eA, eB };
+
+  unsigned max_level{4};
+  Tree<Cell3D> tree(1, max_level);
+  tree.createRootCells(entries);
+  tree.meshAtMinLevel();
+  A->getChildCell(5)->split(max_level);
+  A->getChildCell(5)->getChildCell(5)->split(max_level);
+  A->getChildCell(5)->getChildCell(5)->getChildCell(5)->split(max_level);
+  B->getChildCell(0)->split(max_level);
+  B->getChildCell(0)->getChildCell(0)->split(max_level);
+
+  const auto &all_directions = Cell3D::ChildAndDirectionTablesType::all_directions;
+  const std::vector<int> directions { 0, 1, 2, 3, 4, 5, 6, 9, 18, 25 };
+  unsigned number_finer_neighbors{0};
+  for (Cell3D &cell : tree.ownedLeaves()) {
+    for (const auto &dirs : { std::vector<int>(all_directions.begin(), all_directions.end()), directions }) {
+      std::vector<std::pair<Cell3D*, unsigned>> visited_neighbors, range_neighbors;
+      cell.applyToNeighborLeafCells(
+        [&visited_neighbors](const std::shared_ptr<Cell3D> &c, const std::shared_ptr<Cell3D> &n, const unsigned &dir) {
+          (void)c;
+          visited_neighbors.emplace_back(n.get(), dir);
+        },
+        false, true, dirs
+      );
+      for (const auto &neighbor : cell.neighborLeaves(dirs)) {
+        CHECK(neighbor.cell->isLeaf());
+        number_finer_neighbors += neighbor.cell->getLevel() > cell.getLevel();
+        range_neighbors.emplace_back(neighbor.cell, neighbor.dir);
+      }
+      CHECK(range_neighbors == visited_neighbors);
+    }
+  }
+  CHECK(number_finer_neighbors > 0);
+
+  // Each neighbor is visited once
+  const auto &cell = A->getChildCell(0);
+  std::vector<Cell3D*> neighbors;
+  cell->applyToNeighborCells(
+    [&neighbors](const std::shared_ptr<Cell3D> &c, const std::shared_ptr<Cell3D> &n, const unsigned &dir) {
+      (void)c; (void)dir;
+      neighbors.push_back(n.get());
+    },
+    true, true, { 1, 1, 3, 1 }
+  );
+  CHECK(neighbors.size() == 2);
+}
@@ -1,12 +1,16 @@
 #include <doctest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <core/Cell.h>
 #include <core/Tree.h>
 #include <core/RootCellEntry.h>
+#include <core/iterator/HilbertIterator.h>
 
 // RootCellEntry basic wiring (1D)
 //
@@ -58,8 +62,8 @@ TEST_CASE("[core][tree] Simple Tree (1D)") {
   // Roots should not be leaf and neighbors set properly
   CHECK(!A->isLeaf());
   CHECK(!B->isLeaf());
-  CHECK(A->getNeighborCell(1) == B);
-  CHECK(B->getNeighborCell(0) == A);
+  CHECK(A->getNeighborCell(1) == B.get());
+  CHECK(B->getNeighborCell(0) == A.get());
 }
 
 // Simple Tree (2D)
@@ -94,12 +98,480 @@ TEST_CASE("[core][tree] Simple Tree (2D)") {
   Tree<Cell2D> tree;
   tree.createRootCells(entries);
 
-  CHECK(A->getNeighborCell(1) == B);
-  CHECK(A->getNeighborCell(3) == C);
-  CHECK(B->getNeighborCell(0) == A);
-  CHECK(B->getNeighborCell(3) == D);
-  CHECK(C->getNeighborCell(1) == D);
-  CHECK(C->getNeighborCell(2) == A);
-  CHECK(D->getNeighborCell(0) == C);
-  CHECK(D->getNeighborCell(2) == B);
+  CHECK(A->getNeighborCell(1) == B.get());
+  CHECK(A->getNeighborCell(3) == C.get());
+  CHECK(B->getNeighborCell(0) == A.get());
+  CHECK(B->getNeighborCell(3) == D.get());
+  CHECK(C->getNeighborCell(1) == D.get());
+  CHECK(C->getNeighborCell(2) == A.get());
+  CHECK(D->getNeighborCell(0) == C.get());
+  CHECK(D->getNeighborCell(2) == B.get());
+}
+
+// Cell index kept up to date on split and coarsening (2D)
+//
+//                ┌───────┐┌───────┐
+//                │       ││       │
+// structure  ->  ├───┬───┤├───┬───┤  (a level 3 cell is then created in A and removed)
+//                │   │   ││   │   │
+//                └───┴───┘└───┴───┘
+template<typename TreeType>
+void check_cell_index() {
+  using CellType = typename TreeType::CellType;
+  using TreeIteratorType = typename TreeType::TreeIteratorType;
+  auto A = std::make_shared<CellType>(nullptr);
+  auto B = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A}, eB{B};
+  eA.setNeighbor(1, B);   // A +x -> B
+  eB.setNeighbor(0, A);   // B -x -> A
+  std::vector<RootCellEntry<CellType>> entries { eA, eB };
+
+  TreeType tree(1, 3);
+  tree.createRootCells(entries);
+  TreeIteratorType iterator(tree.getRootCells(), tree.getMaxLevel());
+  auto &cell_index = tree.getCellIndex();
+
+  // Every cell is found from its key
+  const auto check_all_cells = [&]() {
+    CHECK(cell_index.size() == tree.countCells());
+    tree.applyToAllCells([&](const std::shared_ptr<CellType> &cell, const unsigned index) {
+      (void)index;
+      CHECK(cell_index.find(iterator.getCellKey(cell)) == cell.get());
+    });
+  };
+  check_all_cells();
+
+  // Create a level 3 cell (its ancestors and the neighbors needed for the 2:1 balance are split)
+  const auto key = iterator.getCellIdManager().orderPathToKey({ 0, 2, 1, 3 });
+  CHECK(cell_index.find(key) == nullptr);
+  CellType *cell = cell_index.findOrCreate(key);
+  CHECK(cell->getLevel() == 3);
+  CHECK(iterator.getCellKey(cell) == key);
+  CHECK(cell_index.findOrCreate(key) == cell);
+  check_all_cells();
+
+  // Coarsening removes the child cells
+  CellType *parent_cell = cell->getParentOct()->getParentCell();
+  CHECK(parent_cell->coarsen(tree.getMinLevel()));
+  CHECK(cell_index.find(key) == nullptr);
+  CHECK(cell_index.find(iterator.getCellKey(parent_cell)) == parent_cell);
+  check_all_cells();
+
+  // Keys deeper than the max level are rejected
+  bool exception_thrown = false;
+  try {
+    cell_index.findOrCreate(iterator.getCellIdManager().orderPathToKey({ 0, 2, 1, 3, 0 }));
+  } catch (const std::exception &e) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+}
+
+TEST_CASE("[core][tree] Cell index (Morton)") {
+  using Cell2D = Cell<2,2>;
+  check_cell_index<Tree<Cell2D, MortonIterator<Cell2D>>>();
+}
+
+TEST_CASE("[core][tree] Cell index (Hilbert)") {
+  using Cell2D = Cell<2,2>;
+  check_cell_index<Tree<Cell2D, HilbertIterator<Cell2D>>>();
+}
+
+// Level by level traversal (2D)
+// The cells of each level follow the SFC after splits and coarsening
+template<typename TreeType>
+void check_level_traversal() {
+  using CellType = typename TreeType::CellType;
+  using SfcLeafIteratorType = typename TreeType::SfcLeafIteratorType;
+  auto A = std::make_shared<CellType>(nullptr);
+  auto B = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A}, eB{B};
+  eA.setNeighbor(1, B);   // A +x -> B
+  eB.setNeighbor(0, A);   // B -x -> A
+  std::vector<RootCellEntry<CellType>> entries { eA, eB };
+
+  unsigned max_level{4};
+  TreeType tree(1, max_level);
+  tree.createRootCells(entries);
+  tree.meshAtMinLevel();
+
+  // Owned (or ghost) cells of each level from sweeps stopping at the level
+  const auto check_levels = [&]() {
+    SfcLeafIteratorType iterator(tree.getRootCells(), max_level);
+    for (unsigned level{0}; level<=max_level; ++level)
+      for (const bool ghost : { false, true }) {
+        std::vector<CellType*> expected_cells, cells;
+        iterator.toBegin(level);
+        do {
+          CellType *cell = iterator.getCellPtr();
+          if (iterator.getLevel() == level && (ghost ? cell->belongToOtherProc() : cell->belongToThisProc()))
+            expected_cells.push_back(cell);
+        } while (iterator.next(level));
+        tree.applyToLevel(level, [&cells](const std::shared_ptr<CellType> &cell, const unsigned index) {
+          CHECK(index == cells.size());
+          cells.push_back(cell.get());
+        }, ghost);
+        CHECK(cells == expected_cells);
+      }
+  };
+  check_levels();
+
+  A->getChildCell(1)->split(max_level);
+  A->getChildCell(1)->getChildCell(2)->split(max_level);
+  B->getChildCell(3)->split(max_level);
+  check_levels();
+
+  A->getChildCell(1)->getChildCell(2)->getChildCell(0)->split(max_level);
+  CHECK(B->getChildCell(3)->coarsen(tree.getMinLevel()));
+  check_levels();
+
+  A->getChildCell(0)->setToOtherProcRecurs();
+  A->setToThisProc();
+  check_levels();
+
+  bool exception_thrown = false;
+  try {
+    tree.applyToLevel(max_level+1, [](const std::shared_ptr<CellType> &cell, const unsigned index) { (void)cell; (void)index; });
+  } catch (const std::exception &e) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+}
+
+TEST_CASE("[core][tree] Level by level traversal (Morton)") {
+  using Cell2D = Cell<2,2>;
+  check_level_traversal<Tree<Cell2D, MortonIterator<Cell2D>>>();
+}
+
+TEST_CASE("[core][tree] Level by level traversal (Hilbert)") {
+  using Cell2D = Cell<2,2>;
+  check_level_traversal<Tree<Cell2D, HilbertIterator<Cell2D>>>();
+}
+
+// Parallel owned leaf traversal (2D)
+// The owned leaves are split in chunks at several levels and each leaf is visited once with its sequential position
+TEST_CASE("[core][tree] Parallel owned leaf traversal (2D)") {
+  using Cell2D = Cell<2,2>;
+  auto A = std::make_shared<Cell2D>(nullptr);
+  auto B = std::make_shared<Cell2D>(nullptr);
+  RootCellEntry<Cell2D> eA{A}, eB{B};
+  eA.setNeighbor(1, B);   // A +x -> B
+  eB.setNeighbor(0, A);   // B -x -> A
+  std::vector<RootCellEntry<Cell2D>> entries { eA, eB };
+
+  unsigned max_level{5};
+  Tree<Cell2D> tree(2, max_level);
+  tree.createRootCells(entries);
+  tree.meshAtMinLevel();
+  A->getChildCell(3)->getChildCell(0)->split(max_level);
+  A->getChildCell(3)->getChildCell(0)->getChildCell(3)->split(max_level);
+  B->getChildCell(2)->getChildCell(1)->split(max_level);
+  A->getChildCell(0)->setToOtherProcRecurs();
+
+  std::vector<Cell2D*> owned_cells;
+  tree.applyToOwnedLeaves([&owned_cells](const std::shared_ptr<Cell2D> &cell, const unsigned index) {
+    (void)index;
+    owned_cells.push_back(cell.get());
+  });
+
+  WorkStealingPool pool(3);
+  const auto check_parallel_traversal = [&](const int chunk_level) {
+    std::vector<Cell2D*> cells(owned_cells.size(), nullptr);
+    std::vector<unsigned> number_visits(owned_cells.size(), 0), threads(owned_cells.size(), 0);
+    const auto visit = [&cells, &number_visits, &threads](const std::shared_ptr<Cell2D> &cell, const unsigned index, const unsigned thread) {
+      cells[index] = cell.get();
+      ++number_visits[index];
+      threads[index] = thread;
+    };
+    if (chunk_level < 0)
+      tree.applyToOwnedLeavesParallel(visit, pool);
+    else
+      tree.applyToOwnedLeavesParallel(visit, pool, chunk_level);
+    CHECK(cells == owned_cells);
+    CHECK(number_visits == std::vector<unsigned>(owned_cells.size(), 1));
+    CHECK(*std::max_element(threads.begin(), threads.end()) < pool.getNumberThreads());
+  };
+  for (int chunk_level{-1}; chunk_level<=static_cast<int>(max_level); ++chunk_level)
+    check_parallel_traversal(chunk_level);
+}
+
+// Batches of consecutive owned leaves (2D)
+template<unsigned N, typename TreeType, typename CellType = typename TreeType::CellType>
+void check_owned_leaf_batches(const TreeType &tree, const std::vector<CellType*> &owned_cells) {
+  std::vector<CellType*> cells;
+  unsigned number_batches{0};
+  bool passed = true;
+  tree.template applyToOwnedLeafBatches<N>([&](const LeafBatch<CellType, N> &batch) {
+    ++number_batches;
+    passed &= (batch.first_index == cells.size());
+    passed &= (batch.size > 0 && batch.size <= N);
+    passed &= (batch.full() || (cells.size() + batch.size == owned_cells.size()));
+    for (unsigned lane{0}; lane<N; ++lane) {
+      const unsigned valid_lane = std::min(lane, batch.size-1);
+      passed &= (batch.indices[lane] == batch.first_index + valid_lane);
+      passed &= (batch.cells[lane] == owned_cells[batch.first_index + valid_lane]);
+      passed &= (batch.levels[lane] == batch.cells[lane]->getLevel());
+    }
+    cells.insert(cells.end(), batch.cells.begin(), batch.cells.begin() + batch.size);
+  });
+  CHECK(passed);
+  CHECK(cells == owned_cells);
+  CHECK(number_batches == (owned_cells.size() + N - 1)/N);
+}
+
+TEST_CASE("[core][tree] Owned leaf batches (2D)") {
+  using Cell2D = Cell<2,2>;
+  auto A = std::make_shared<Cell2D>(nullptr);
+  auto B = std::make_shared<Cell2D>(nullptr);
+  RootCellEntry<Cell2D> eA{A}, eB{B};
+  eA.setNeighbor(1, B);   // A +x -> B
+  eB.setNeighbor(0, A);   // B -x -> A
+  std::vector<RootCellEntry<Cell2D>> entries { eA, eB };
+
+  unsigned max_level{4};
+  Tree<Cell2D> tree(2, max_level);
+  tree.createRootCells(entries);
+  tree.meshAtMinLevel();
+  A->getChildCell(3)->getChildCell(0)->split(max_level);
+  B->getChildCell(2)->getChildCell(1)->split(max_level);
+  A->getChildCell(0)->setToOtherProcRecurs();
+
+  std::vector<Cell2D*> owned_cells;
+  for (Cell2D &cell : tree.ownedLeaves())
+    owned_cells.push_back(&cell);
+  check_owned_leaf_batches<1>(tree, owned_cells);
+  check_owned_leaf_batches<4>(tree, owned_cells);
+  check_owned_leaf_batches<7>(tree, owned_cells);
+  check_owned_leaf_batches<8>(tree, owned_cells);
+  check_owned_leaf_batches<64>(tree, owned_cells);
+}
+
+// Fields stored per owned leaf and remapped on refine and coarsen (1D)
+//
+//                │   A   │             │ │ │   │             │   A   │
+// structure  ->  └───┴───┘  refine ->  └─┴─┴───┘  coarsen ->  └───┴───┘
+TEST_CASE("[core][tree] Field registry remapping (1D)") {
+  using Cell1D = Cell<2>;
+  auto A = std::make_shared<Cell1D>(nullptr);
+  RootCellEntry<Cell1D> eA{A};
+  std::vector<RootCellEntry<Cell1D>> entries { eA };
+
+  Tree<Cell1D> tree(1, 3);
+  tree.createRootCells(entries);
+  tree.addField("u", 2);
+  CHECK(tree.getFieldRegistry().hasField("u"));
+  CHECK(tree.getField("u").size() == 2);
+  bool exception_thrown = false;
+  try {
+    tree.getField("v"); // field not registered
+  } catch (const std::exception &e) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+
+  auto u0 = tree.getField("u", 0), u1 = tree.getField("u", 1);
+  u0[0] = 1.; u0[1] = 2.;
+  u1[0] = 10.; u1[1] = 20.;
+
+  // Refined leaves get the value of their parent
+  A->getChildCell(0)->setToRefine();
+  CHECK(tree.refine());
+  u0 = tree.getField("u", 0); u1 = tree.getField("u", 1);
+  CHECK(u0.size() == 3);
+  CHECK(u0[0] == 1.); CHECK(u0[1] == 1.); CHECK(u0[2] == 2.);
+  CHECK(u1[0] == 10.); CHECK(u1[1] == 10.); CHECK(u1[2] == 20.);
+
+  // Coarsened leaves get the average of their children
+  u0[0] = 3.; u0[1] = 5.;
+  A->getChildCell(0)->getChildCell(0)->setToCoarse();
+  A->getChildCell(0)->getChildCell(1)->setToCoarse();
+  CHECK(tree.coarsen());
+  u0 = tree.getField("u", 0); u1 = tree.getField("u", 1);
+  CHECK(u0.size() == 2);
+  CHECK(u0[0] == 4.); CHECK(u0[1] == 2.);
+  CHECK(u1[0] == 10.); CHECK(u1[1] == 20.);
+
+  tree.getFieldRegistry().removeField("u");
+  CHECK(tree.getFieldRegistry().empty());
+}
+
+// Fields remapped by the meshing at min level (1D)
+//
+//                │   A   │                 │       A       │
+// structure  ->  └───┴───┘  min level ->  └───┴───┴───┴───┘
+TEST_CASE("[core][tree] Field registry remapping at min level (1D)") {
+  using Cell1D = Cell<2>;
+  auto A = std::make_shared<Cell1D>(nullptr);
+  RootCellEntry<Cell1D> eA{A};
+  std::vector<RootCellEntry<Cell1D>> entries { eA };
+
+  Tree<Cell1D> tree(2, 3);
+  tree.createRootCells(entries);
+  tree.addField("u");
+  auto u = tree.getField("u");
+  CHECK(u.size() == 2);
+  u[0] = 1.; u[1] = 2.;
+
+  // Leaves split to the min level get the value of their parent
+  tree.meshAtMinLevel();
+  u = tree.getField("u");
+  CHECK(u.size() == 4);
+  CHECK(u[0] == 1.); CHECK(u[1] == 1.); CHECK(u[2] == 2.); CHECK(u[3] == 2.);
+}
+
+// Adaptation log (1D)
+//
+//                │       A       │       B       │
+// structure  ->  └───────┴───┴─┴─┴───┴───┴───────┘
+TEST_CASE("[core][tree] Adaptation log (1D)") {
+  using Cell1D = Cell<2>;
+  using CellKeyType = Tree<Cell1D>::CellKeyType;
+  auto A = std::make_shared<Cell1D>(nullptr);
+  auto B = std::make_shared<Cell1D>(nullptr);
+  RootCellEntry<Cell1D> eA{A}, eB{B};
+  eA.setNeighbor(1, B);
+  eB.setNeighbor(0, A);
+  std::vector<RootCellEntry<Cell1D>> entries { eA, eB };
+
+  Tree<Cell1D> tree(1, 3);
+  bool exception_thrown = false;
+  try {
+    tree.getAdaptationLog(); // log not enabled
+  } catch (const std::exception &e) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+  tree.enableAdaptationLog();
+  tree.createRootCells(entries);
+  CHECK(tree.isAdaptationLogEnabled());
+  const auto &log = tree.getAdaptationLog();
+  CHECK(log.empty());
+
+  // Splitting the last leaf of A splits the first leaf of B for the 2:1 balance
+  MortonIterator<Cell1D> iterator(tree.getRootCells(), tree.getMaxLevel());
+  const auto key_A1 = iterator.getCellKey(A->getChildCell(1)), key_B0 = iterator.getCellKey(B->getChildCell(0));
+  A->getChildCell(1)->setToRefine();
+  CHECK(tree.refine());
+  CHECK(log.getCreatedFamilies() == std::vector<CellKeyType>{ key_A1 });
+  A->getChildCell(1)->getChildCell(1)->setToRefine();
+  CHECK(tree.refine());
+  const auto key_A11 = iterator.getCellKey(A->getChildCell(1)->getChildCell(1));
+  CHECK(log.getCreatedFamilies() == std::vector<CellKeyType>{ key_A11, key_B0 });
+  CHECK(log.getRemovedFamilies().empty());
+
+  // Nothing recorded by a call that does not change the mesh
+  CHECK(!tree.refine());
+  CHECK(log.empty());
+
+  // Families removed along the SFC (B0 is coarsened once A11 is)
+  for (const auto &cell : B->getChildCell(0)->getChildCells())
+    cell->setToCoarse();
+  for (const auto &cell : A->getChildCell(1)->getChildCell(1)->getChildCells())
+    cell->setToCoarse();
+  CHECK(tree.coarsen());
+  CHECK(log.getCreatedFamilies().empty());
+  CHECK(log.getRemovedFamilies() == std::vector<CellKeyType>{ key_A11, key_B0 });
+  CHECK(log.getSentRanges().empty());
+  CHECK(log.getReceivedRanges().empty());
+
+  // Bulk refinement records the balance splits too
+  A->getChildCell(1)->getChildCell(1)->setToRefine();
+  CHECK(tree.refineBulk().number_balance == 1);
+  CHECK(log.getCreatedFamilies() == std::vector<CellKeyType>{ key_A11, key_B0 });
+
+  // Nothing recorded once disabled
+  tree.enableAdaptationLog(false);
+  CHECK(!tree.isAdaptationLogEnabled());
+  A->getChildCell(0)->setToRefine();
+  CHECK(tree.refine());
+  CHECK(!A->getChildCell(0)->isLeaf());
+}
+
+// Brick of root cells (2D, periodic along x)
+//
+//                │ 3 │ 4 │ 5 │
+// structure  ->  │ 0 │ 1 │ 2 │  (root 0 -x -> root 2, root 2 +x -> root 0)
+TEST_CASE("[core][tree] Brick of root cells (2D)") {
+  using Cell2D = Cell<2,2>;
+  const auto entries = RootCellEntry<Cell2D>::createBrick({3, 2}, {true, false});
+  CHECK(entries.size() == 6);
+
+  // Inner connectivity
+  CHECK(entries[1].getNeighbor(0) == entries[0].cell);
+  CHECK(entries[1].getNeighbor(1) == entries[2].cell);
+  CHECK(entries[1].getNeighbor(2) == nullptr);
+  CHECK(entries[1].getNeighbor(3) == entries[4].cell);
+  CHECK(entries[4].getNeighbor(2) == entries[1].cell);
+  CHECK(entries[4].getNeighbor(3) == nullptr);
+  // Periodic connectivity along x only
+  CHECK(entries[0].getNeighbor(0) == entries[2].cell);
+  CHECK(entries[2].getNeighbor(1) == entries[0].cell);
+  CHECK(entries[5].getNeighbor(1) == entries[3].cell);
+
+  // The tree keeps the root index on the cells and the owned roots range
+  Tree<Cell2D> tree(1, 3);
+  tree.createBrickRootCells({3, 2}, {true, false});
+  const auto &root_cells = tree.getRootCells();
+  CHECK(root_cells.size() == 6);
+  for (unsigned i{0}; i<root_cells.size(); ++i)
+    CHECK(root_cells[i]->getRootIndex() == i);
+  CHECK(root_cells[0]->getNeighborCell(0) == root_cells[2].get());
+  CHECK(root_cells[3]->getNeighborCell(2) == root_cells[0].get());
+  CHECK(tree.getOwnedRoots() == std::make_pair(0u, 6u));
+  CHECK(tree.countOwnedLeaves() == 6*Cell2D::number_children);
+
+  // Splitting across the periodic boundary keeps the 2:1 balance through the wrapped neighbors
+  root_cells[0]->getChildCell(0)->split(tree.getMaxLevel());
+  root_cells[0]->getChildCell(0)->getChildCell(0)->split(tree.getMaxLevel());
+  CHECK(!root_cells[2]->getChildCell(1)->isLeaf());
+
+  bool exception_thrown{false};
+  try {
+    RootCellEntry<Cell2D>::createBrick({3, 0});
+  } catch (const std::runtime_error&) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+}
+
+// Owned root range (the outer roots belong to another process)
+TEST_CASE("[core][tree] Owned root range") {
+  using Cell1D = Cell<2>;
+  Tree<Cell1D> tree(1, 3);
+  tree.createBrickRootCells({5});
+  const auto &root_cells = tree.getRootCells();
+  root_cells[0]->setToOtherProcRecurs();
+  root_cells[4]->setToOtherProcRecurs();
+
+  // The counting checks the range in case the flags were changed outside the tree
+  CHECK(tree.getOwnedRoots() == std::make_pair(0u, 5u));
+  CHECK(tree.countOwnedLeaves() == 3*Cell1D::number_children);
+  tree.updateOwnedRoots();
+  CHECK(tree.getOwnedRoots() == std::make_pair(1u, 4u));
+
+  // Iterators positioned from a stale or an exact range
+  for (const auto &owned_roots : {std::make_pair(0u, 5u), std::make_pair(1u, 4u), std::make_pair(2u, 3u)}) {
+    MortonIterator<Cell1D> iterator(root_cells, tree.getMaxLevel());
+    iterator.setOwnedRoots(owned_roots);
+    CHECK(iterator.toOwnedBegin());
+    CHECK(iterator.getIndexPath()[0] == 1);
+    CHECK(iterator.toOwnedEnd());
+    CHECK(iterator.getIndexPath()[0] == 3);
+
+    SfcLeafIterator<Cell1D, MortonIterator<Cell1D>> leaf_iterator(root_cells, tree.getMaxLevel());
+    leaf_iterator.setOwnedRoots(owned_roots);
+    CHECK(leaf_iterator.toOwnedBegin());
+    CHECK(leaf_iterator.getIndexPath()[0] == 1);
+    CHECK(leaf_iterator.toOwnedEnd());
+    CHECK(leaf_iterator.getIndexPath()[0] == 3);
+  }
+
+  // No owned root
+  for (const auto &root_cell : root_cells)
+    root_cell->setToOtherProcRecurs();
+  tree.updateOwnedRoots();
+  CHECK(tree.getOwnedRoots().first == tree.getOwnedRoots().second);
+  CHECK(tree.countOwnedLeaves() == 0);
+  auto owned_leaves = tree.ownedLeaves();
+  CHECK(owned_leaves.begin() == owned_leaves.end());
 }
@@ -1,12 +1,20 @@
 #include <doctest.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <stdexcept>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include <core/Cell.h>
 #include <core/Tree.h>
 #include <core/RootCellEntry.h>
+#include <core/iterator/HilbertIterator.h>
+#include <core/iterator/MortonIterator.h>
+#include <core/iterator/PeanoIterator.h>
+#include <core/iterator/SfcLeafIterator.h>
 
 // Iterator leaf cell counting (1 root cell)
 //                ┌───┬───┬───────┐
@@ -81,3 +89,266 @@ TEST_CASE("[core][tree_iterator] Iterator leaf cell counting (2 root cells)") {
 
   CHECK(number_leaf_cells == 14);
 }
+
+// Key driven leaf iterator follows the same curve as the tree iterator
+// (2 root cells split down to level 4 in a corner of A, first two level 1 cells of A on another process)
+template<typename CellType, typename TreeIteratorType>
+void check_sfc_leaf_iterator() {
+  auto A = std::make_shared<CellType>(nullptr);
+  auto B = std::make_shared<CellType>(nullptr);
+  RootCellEntry<CellType> eA{A}, eB{B};
+  eA.setNeighbor(1, B);          // A +x -> B
+  eB.setNeighbor(0, A);          // B -x -> A
+  std::vector<RootCellEntry<CellType>> entries { eA, eB };
+
+  unsigned min_level{1}, max_level{4};
+  Tree<CellType, TreeIteratorType> tree(min_level, max_level);
+  tree.createRootCells(entries);
+  CellType *cell = A->getChildCell(CellType::number_children-1).get();
+  for (unsigned level{1}; level<max_level; ++level) {
+    cell->split(max_level);
+    cell = cell->getChildCell(0).get();
+  }
+  B->getChildCell(1)->split(max_level);
+  A->getChildCell(0)->setToOtherProcRecurs();
+  A->getChildCell(1)->setToOtherProcRecurs();
+
+  TreeIteratorType iterator(tree.getRootCells(), max_level);
+  SfcLeafIterator<CellType, TreeIteratorType> sfc_iterator(tree.getRootCells(), max_level);
+  const auto check_same_cell = [&]() {
+    CHECK(sfc_iterator.getCellPtr() == iterator.getCellPtr());
+    CHECK(sfc_iterator.getCell() == iterator.getCell());
+    CHECK(sfc_iterator.getCellKey() == iterator.getCellKey());
+    CHECK(sfc_iterator.getIndexPath() == iterator.getIndexPath());
+    CHECK(sfc_iterator.getOrderPath() == iterator.getOrderPath());
+  };
+
+  for (const unsigned sweep_level : { 1u, 2u, 3u, max_level }) {
+    // All leaves forward and backward
+    unsigned number_leaves{0};
+    iterator.toBegin(sweep_level);
+    sfc_iterator.toBegin(sweep_level);
+    bool loop;
+    do {
+      check_same_cell();
+      ++number_leaves;
+      loop = iterator.next(sweep_level);
+      CHECK(sfc_iterator.next(sweep_level) == loop);
+    } while (loop);
+    check_same_cell();
+    iterator.toEnd(sweep_level);
+    sfc_iterator.toEnd(sweep_level);
+    do {
+      check_same_cell();
+      --number_leaves;
+      loop = iterator.prev(sweep_level);
+      CHECK(sfc_iterator.prev(sweep_level) == loop);
+    } while (loop);
+    CHECK(number_leaves == 0);
+
+    // Owned leaves forward and backward
+    CHECK(sfc_iterator.toOwnedBegin(sweep_level) == iterator.toOwnedBegin(sweep_level));
+    do {
+      check_same_cell();
+      loop = iterator.ownedNext(sweep_level);
+      CHECK(sfc_iterator.ownedNext(sweep_level) == loop);
+    } while (loop);
+    CHECK(sfc_iterator.toOwnedEnd(sweep_level) == iterator.toOwnedEnd(sweep_level));
+    do {
+      check_same_cell();
+      loop = iterator.ownedPrev(sweep_level);
+      CHECK(sfc_iterator.ownedPrev(sweep_level) == loop);
+    } while (loop);
+  }
+
+  // Owned leaf range and templated visitor follow the same cells as the tree iterator
+  std::vector<CellType*> owned_cells, visited_cells, range_cells;
+  iterator.toOwnedBegin();
+  do {
+    owned_cells.push_back(iterator.getCellPtr());
+  } while (iterator.ownedNext());
+  tree.applyToOwnedLeaves([&visited_cells](const std::shared_ptr<CellType> &c, const unsigned index) {
+    CHECK(index == visited_cells.size());
+    visited_cells.push_back(c.get());
+  });
+  for (CellType &c : tree.ownedLeaves())
+    range_cells.push_back(&c);
+  CHECK(visited_cells == owned_cells);
+  CHECK(range_cells == owned_cells);
+}
+
+TEST_CASE("[core][tree_iterator] Key driven leaf iterator (2D)") {
+  using Cell2D = Cell<2,2>;
+  check_sfc_leaf_iterator<Cell2D, MortonIterator<Cell2D>>();
+  check_sfc_leaf_iterator<Cell2D, HilbertIterator<Cell2D>>();
+  using Cell2D3 = Cell<3,3>;
+  check_sfc_leaf_iterator<Cell2D3, PeanoIterator<Cell2D3>>();
+}
+
+TEST_CASE("[core][tree_iterator] Key driven leaf iterator (3D)") {
+  using Cell3D = Cell<2,2,2>;
+  check_sfc_leaf_iterator<Cell3D, MortonIterator<Cell3D>>();
+  check_sfc_leaf_iterator<Cell3D, HilbertIterator<Cell3D>>();
+}
+
+// Bulk positioning of the iterator on a list of keys (climbs only to the common ancestor of consecutive keys)
+template<typename CellType, typename TreeIteratorType>
+void check_cell_keys_seek() {
+  const auto make_tree = [](Tree<CellType, TreeIteratorType> &tree) {
+    auto A = std::make_shared<CellType>(nullptr);
+    auto B = std::make_shared<CellType>(nullptr);
+    RootCellEntry<CellType> eA{A}, eB{B};
+    eA.setNeighbor(1, B);          // A +x -> B
+    eB.setNeighbor(0, A);          // B -x -> A
+    std::vector<RootCellEntry<CellType>> entries { eA, eB };
+    tree.createRootCells(entries);
+  };
+
+  unsigned min_level{0}, max_level{4};
+  Tree<CellType, TreeIteratorType> tree(min_level, max_level), other_tree(min_level, max_level);
+  make_tree(tree);
+  make_tree(other_tree);
+  CellType *cell = tree.getRootCells()[0]->getChildCell(CellType::number_children-1).get();
+  for (unsigned level{1}; level<max_level; ++level) {
+    cell->split(max_level);
+    cell = cell->getChildCell(level%CellType::number_children).get();
+  }
+  tree.getRootCells()[1]->getChildCell(1)->split(max_level);
+
+  // Leaf keys along the curve
+  TreeIteratorType iterator(tree.getRootCells(), max_level);
+  std::vector<typename TreeIteratorType::CellKeyType> leaf_keys;
+  std::vector<std::vector<unsigned>> leaf_ids;
+  std::vector<CellType*> leaf_cells;
+  iterator.toBegin();
+  do {
+    leaf_keys.push_back(iterator.getCellKey());
+    leaf_ids.push_back(iterator.getCellId());
+    leaf_cells.push_back(iterator.getCellPtr());
+  } while (iterator.next());
+
+  // Existing cells in curve order and in reverse order
+  std::vector<CellType*> visited_cells;
+  iterator.toCellKeys(leaf_keys, false, [&visited_cells](const std::shared_ptr<CellType> &c, const unsigned i) {
+    CHECK(i == visited_cells.size());
+    visited_cells.push_back(c.get());
+  });
+  CHECK(visited_cells == leaf_cells);
+  std::vector<typename TreeIteratorType::CellKeyType> reversed_keys(leaf_keys.rbegin(), leaf_keys.rend());
+  visited_cells.clear();
+  iterator.toCellKeys(reversed_keys, false, [&visited_cells](const std::shared_ptr<CellType> &c, const unsigned) {
+    visited_cells.push_back(c.get());
+  });
+  CHECK(std::vector<CellType*>(visited_cells.rbegin(), visited_cells.rend()) == leaf_cells);
+
+  // Create the same leaves in the other tree from the cell IDs
+  TreeIteratorType other_iterator(other_tree.getRootCells(), max_level);
+  std::vector<typename TreeIteratorType::CellKeyType> created_keys;
+  other_iterator.toCellIds(leaf_ids, true, [&created_keys, &other_iterator](const std::shared_ptr<CellType> &c, const unsigned) {
+    CHECK(c->isLeaf());
+    created_keys.push_back(other_iterator.getCellKey(c));
+  });
+  CHECK(created_keys == leaf_keys);
+  CHECK(other_tree.countOwnedLeaves() == tree.countOwnedLeaves());
+
+  // A key below a leaf cannot be reached without creating it
+  Tree<CellType, TreeIteratorType> coarse_tree(min_level, max_level);
+  make_tree(coarse_tree);
+  TreeIteratorType coarse_iterator(coarse_tree.getRootCells(), max_level);
+  bool exception_thrown{false};
+  try {
+    coarse_iterator.toCellKeys(leaf_keys, false, [](const std::shared_ptr<CellType>&, const unsigned) {});
+  } catch (const std::runtime_error&) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+}
+
+TEST_CASE("[core][tree_iterator] Bulk positioning on sorted keys (2D)") {
+  using Cell2D = Cell<2,2>;
+  check_cell_keys_seek<Cell2D, MortonIterator<Cell2D>>();
+  check_cell_keys_seek<Cell2D, HilbertIterator<Cell2D>>();
+  using Cell2D3 = Cell<3,3>;
+  check_cell_keys_seek<Cell2D3, PeanoIterator<Cell2D3>>();
+}
+
+TEST_CASE("[core][tree_iterator] Bulk positioning on sorted keys (3D)") {
+  using Cell3D = Cell<2,2,2>;
+  check_cell_keys_seek<Cell3D, MortonIterator<Cell3D>>();
+}
+
+// Hilbert and Peano curves are continuous: consecutive leaves of a uniform tree are face neighbors
+template<typename CellType, typename TreeIteratorType>
+void check_curve_continuity(const unsigned max_level) {
+  auto A = std::make_shared<CellType>(nullptr);
+  std::vector<RootCellEntry<CellType>> entries { RootCellEntry<CellType>{A} };
+  Tree<CellType, TreeIteratorType> tree(0, max_level);
+  tree.createRootCells(entries);
+  for (unsigned level{1}; level<max_level; ++level) {
+    std::vector<std::shared_ptr<CellType>> leaves;
+    tree.applyToOwnedLeaves([&leaves](const std::shared_ptr<CellType> &cell, const unsigned) { leaves.push_back(cell); });
+    for (const auto &leaf : leaves)
+      if (leaf->isLeaf())
+        leaf->split(max_level);
+  }
+
+  const std::array<int, 3> N{ std::max(CellType::Nx, 1), std::max(CellType::Ny, 1), std::max(CellType::Nz, 1) };
+  const auto leaf_coords = [&N](const std::vector<unsigned> &index_path) {
+    std::array<int, 3> coords{};
+    for (size_t l{1}; l<index_path.size(); ++l) {
+      int sibling_number = index_path[l];
+      for (unsigned d{0}; d<3; ++d) {
+        coords[d] = coords[d]*N[d] + sibling_number%N[d];
+        sibling_number /= N[d];
+      }
+    }
+    return coords;
+  };
+
+  TreeIteratorType iterator(tree.getRootCells(), max_level);
+  unsigned number_leaves{1}, number_jumps{0};
+  iterator.toBegin();
+  std::array<int, 3> coords = leaf_coords(iterator.getIndexPath());
+  CHECK(coords == std::array<int, 3>{});
+  while (iterator.next()) {
+    CHECK(iterator.getCellKey() == iterator.getCellKey(iterator.getCellPtr()));
+    CHECK(iterator.orderToIndexPath(iterator.getOrderPath()) == iterator.getIndexPath());
+    const std::array<int, 3> next_coords = leaf_coords(iterator.getIndexPath());
+    const int distance = std::abs(next_coords[0]-coords[0]) + std::abs(next_coords[1]-coords[1]) + std::abs(next_coords[2]-coords[2]);
+    number_jumps += distance != 1;
+    coords = next_coords;
+    ++number_leaves;
+  }
+  CHECK(number_jumps == 0);
+  CHECK(number_leaves == static_cast<unsigned>(std::pow(CellType::number_children, max_level)));
+}
+
+TEST_CASE("[core][tree_iterator] Hilbert curve is continuous") {
+  check_curve_continuity<Cell<2,2>, HilbertIterator<Cell<2,2>>>(5);
+  check_curve_continuity<Cell<2,2,2>, HilbertIterator<Cell<2,2,2>>>(3);
+}
+
+TEST_CASE("[core][tree_iterator] Peano curve is continuous") {
+  check_curve_continuity<Cell<3,3>, PeanoIterator<Cell<3,3>>>(4);
+  check_curve_continuity<Cell<3,3,3>, PeanoIterator<Cell<3,3,3>>>(2);
+}
+
+TEST_CASE("[core][tree_iterator] Iterators are dispatched statically") {
+  // No virtual table: the curve steps are resolved at compile time
+  CHECK(!std::is_polymorphic_v<HilbertIterator<Cell<2,2>>>);
+  CHECK(!std::is_polymorphic_v<MortonIterator<Cell<2,2,2>, 321>>);
+  CHECK(!std::is_polymorphic_v<PeanoIterator<Cell<3,3>>>);
+}
+
+TEST_CASE("[core][tree_iterator] Peano iterator rejects even splitting") {
+  using Cell2D = Cell<2,2>;
+  auto A = std::make_shared<Cell2D>(nullptr);
+  std::vector<std::shared_ptr<Cell2D>> roots = { A };
+  bool exception_thrown{false};
+  try {
+    PeanoIterator<Cell2D> iterator(roots, 2);
+  } catch (const std::runtime_error&) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+}
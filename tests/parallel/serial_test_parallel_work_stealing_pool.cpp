@@ -0,0 +1,77 @@
+#include <doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <parallel/WorkStealingPool.h>
+
+// Every task runs once, on several batches
+TEST_CASE("[parallel][work_stealing_pool] Tasks run once") {
+  WorkStealingPool pool(4);
+  CHECK(pool.getNumberThreads() == 4);
+
+  for (const unsigned number_tasks : { 0u, 1u, 3u, 100u, 1000u }) {
+    std::vector<std::atomic<unsigned>> counts(number_tasks);
+    for (auto &count : counts)
+      count = 0;
+    std::vector<std::atomic<unsigned>> thread_counts(pool.getNumberThreads());
+    for (auto &count : thread_counts)
+      count = 0;
+    pool.run(number_tasks, [&counts, &thread_counts](const unsigned task, const unsigned thread) {
+      ++counts[task];
+      ++thread_counts[thread];
+    });
+    bool passed = true;
+    for (const auto &count : counts)
+      passed &= (count == 1);
+    CHECK(passed);
+    unsigned number_runs{0};
+    for (const auto &count : thread_counts)
+      number_runs += count;
+    CHECK(number_runs == number_tasks);
+  }
+}
+
+// Slow tasks of a thread are stolen by the others
+TEST_CASE("[parallel][work_stealing_pool] Tasks stealing") {
+  WorkStealingPool pool(4);
+  const unsigned number_tasks{64};
+  std::vector<unsigned> task_threads(number_tasks);
+  pool.run(number_tasks, [&task_threads](const unsigned task, const unsigned thread) {
+    task_threads[task] = thread;
+    // The first block of tasks is slow
+    if (task < 16)
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  });
+  unsigned number_stolen{0};
+  for (unsigned task{0}; task<16; ++task)
+    number_stolen += (task_threads[task] != 0);
+  CHECK(number_stolen > 0);
+}
+
+// Task exceptions are rethrown by run
+TEST_CASE("[parallel][work_stealing_pool] Tasks exception") {
+  WorkStealingPool pool(3);
+  std::atomic<unsigned> number_runs{0};
+  bool exception_thrown = false;
+  try {
+    pool.run(30, [&number_runs](const unsigned task, const unsigned thread) {
+      (void)thread;
+      ++number_runs;
+      if (task == 7)
+        throw std::runtime_error("Task failed");
+    });
+  } catch (const std::runtime_error &e) {
+    exception_thrown = true;
+  }
+  CHECK(exception_thrown);
+  CHECK(number_runs == 30);
+
+  // The pool is still usable
+  number_runs = 0;
+  pool.run(10, [&number_runs](const unsigned task, const unsigned thread) { (void)task; (void)thread; ++number_runs; });
+  CHECK(number_runs == 10);
+}